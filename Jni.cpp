@@ -3,5 +3,35 @@
 JNIEXPORT jint JNI_OnLoad(JavaVM* vm, void* /* reserved */)
 {
     gusc::Jni::JVM::init(vm);
+    const auto& manifest = gusc::Jni::JManifest::getDefault();
+    if (manifest.size())
+    {
+        auto env = gusc::Jni::JVM::getEnv();
+        const auto report = manifest.resolveJni(env);
+        if (report.hasErrors())
+        {
+            // Report missing members at load time instead of at their first call
+            auto errorClass = env->FindClass("java/lang/LinkageError");
+            env->ThrowNew(errorClass, report.getErrors().c_str());
+            env->DeleteLocalRef(errorClass);
+            return JNI_ERR;
+        }
+    }
+#if defined(GUSC_JNI_COROUTINES)
+    try
+    {
+        // Register the completion callback while application classes are visible
+        gusc::Jni::JCompletableFuture::init();
+    }
+    catch (const std::exception& e)
+    {
+        auto env = gusc::Jni::JVM::getEnv();
+        env->ExceptionClear();
+        auto errorClass = env->FindClass("java/lang/LinkageError");
+        env->ThrowNew(errorClass, e.what());
+        env->DeleteLocalRef(errorClass);
+        return JNI_ERR;
+    }
+#endif
     return JNI_VERSION_1_6;
 }
@@ -0,0 +1,310 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+class BenchmarkTest : public Test
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr int iterations { 10000 };
+
+    template<typename TFn>
+    double measure(TFn&& fn)
+    {
+        const auto start = Clock::now();
+        for (int n = 0; n < iterations; ++n)
+        {
+            fn();
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+        return static_cast<double>(elapsed.count()) / iterations;
+    }
+
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/BenchmarkClass").createGlobalRef() };
+};
+
+namespace
+{
+// Alternate int and float arguments so that varargs calls pay for float -> double promotion
+template<std::size_t I>
+using BenchmarkArg = std::conditional_t<I % 2 == 0, jint, jfloat>;
+
+template<std::size_t... I>
+void benchmarkInvoke(BenchmarkTest& test, const JObject& obj, std::index_sequence<I...>)
+{
+    constexpr auto count = static_cast<jint>(sizeof...(I));
+    constexpr auto sign = Private::getMethodSignature<jint, BenchmarkArg<I>...>();
+    auto env = JVM::getEnv();
+    const auto methodId = obj.getMethodIdSign(std::string("args") + std::to_string(count), sign.str);
+    jint resVarargs { 0 };
+    jint resJValue { 0 };
+    const auto varargs = test.measure([&]() {
+        resVarargs = obj.invokeMethodJni<jint>(env, methodId, static_cast<BenchmarkArg<I>>(I)...);
+    });
+    const auto jvalues = test.measure([&]() {
+        resJValue = obj.invokeMethodJniA<jint>(env, methodId, static_cast<BenchmarkArg<I>>(I)...);
+    });
+    EXPECT_EQ(resVarargs, count);
+    EXPECT_EQ(resJValue, count);
+    std::cout << "Invoke with " << count << " args: varargs " << varargs << " ns/call, jvalue " << jvalues << " ns/call" << std::endl;
+}
+}
+
+TEST_F(BenchmarkTest, InvokeVarargsVsJValue)
+{
+    auto obj = cls.createObject();
+    benchmarkInvoke(*this, obj, std::make_index_sequence<0>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<1>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<2>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<3>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<4>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<5>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<6>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<7>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<8>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<9>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<10>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<11>{});
+    benchmarkInvoke(*this, obj, std::make_index_sequence<12>{});
+}
+
+TEST_F(BenchmarkTest, FieldByNameVsHandle)
+{
+    auto obj = cls.createObject();
+    JField<jlong> longField { cls, "longField" };
+    jlong sumByName { 0 };
+    jlong sumHandle { 0 };
+    const auto byName = measure([&]() {
+        sumByName += obj.getField<jlong>("longField");
+    });
+    auto env = JVM::getEnv();
+    const auto handle = measure([&]() {
+        sumHandle += longField.getJni(env, obj);
+    });
+    EXPECT_EQ(sumByName, sumHandle);
+    std::cout << "Field read: by name " << byName << " ns/call, handle " << handle << " ns/call" << std::endl;
+}
+
+TEST_F(BenchmarkTest, StaticFieldVsConstant)
+{
+    JStaticConstant<jint> blockSize { cls, "BLOCK_SIZE" };
+    jint sumByName { 0 };
+    jint sumConstant { 0 };
+    const auto byName = measure([&]() {
+        sumByName += cls.getField<jint>("BLOCK_SIZE");
+    });
+    const auto constant = measure([&]() {
+        sumConstant += blockSize.get();
+    });
+    EXPECT_EQ(sumByName, sumConstant);
+    std::cout << "Static final read: by name " << byName << " ns/call, constant " << constant << " ns/call" << std::endl;
+}
+
+TEST_F(BenchmarkTest, ExceptionCheckPerCallVsBatch)
+{
+    constexpr int batchSize { 50 };
+    auto obj = cls.createObject();
+    auto env = JVM::getEnv();
+    const auto methodId = obj.getMethodIdSign("args1", "(I)I");
+    jint sumPerCall { 0 };
+    jint sumBatch { 0 };
+    const auto perCall = measure([&]() {
+        for (jint n = 0; n < batchSize; ++n)
+        {
+            sumPerCall += obj.invokeMethodJni<jint>(env, methodId, n);
+        }
+    });
+    const auto batch = measure([&]() {
+        JExceptionBatch scope { env };
+        for (jint n = 0; n < batchSize; ++n)
+        {
+            sumBatch += obj.invokeMethodJni<jint>(env, methodId, n);
+        }
+    });
+    EXPECT_EQ(sumPerCall, sumBatch);
+    std::cout << "Exception check for " << batchSize << " calls: per call " << perCall << " ns, batch " << batch << " ns" << std::endl;
+}
+
+TEST_F(BenchmarkTest, ColumnsPerObjectVsExtractor)
+{
+    constexpr jint count { 10000 };
+    auto sampleCls = JVM::getEnv().getClass("lv/gusc/jni/tests/SampleClass");
+    JObjectArray samples { sampleCls.invokeMethodSign<jobjectArray>("createArray", "(I)[Llv/gusc/jni/tests/SampleClass;", count) };
+    JColumnExtractor<jlong, jfloat> extractor { sampleCls, "t", "v" };
+    std::vector<jlong> t;
+    std::vector<jfloat> v;
+    const auto perObjectStart = Clock::now();
+    for (jint i = 0; i < count; ++i)
+    {
+        auto obj = samples[i];
+        t.push_back(obj.getField<jlong>("t"));
+        v.push_back(obj.getField<jfloat>("v"));
+    }
+    const auto perObject = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - perObjectStart).count();
+    const auto extractorStart = Clock::now();
+    auto columns = extractor.extract(samples);
+    const auto single = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - extractorStart).count();
+    // Workers are attached once by the pool, not per call
+    JThreadPool pool { 3 };
+    const auto threadedStart = Clock::now();
+    auto threaded = extractor.extract(pool, samples);
+    const auto multi = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - threadedStart).count();
+    EXPECT_EQ(std::get<0>(columns), t);
+    EXPECT_EQ(std::get<1>(threaded), v);
+    std::cout << "Extract " << count << " objects: per object " << perObject << " us, extractor " << single << " us, 3 workers + caller " << multi << " us" << std::endl;
+}
+
+TEST_F(BenchmarkTest, ConstructPerObjectVsBatch)
+{
+    constexpr std::size_t count { 10000 };
+    auto sampleCls = JVM::getEnv().getClass("lv/gusc/jni/tests/SampleClass");
+    std::vector<jlong> t(count, 1);
+    std::vector<jfloat> v(count, 2.f);
+    const auto perObjectStart = Clock::now();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto obj = sampleCls.createObject(t[i], v[i]);
+    }
+    const auto perObject = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - perObjectStart).count();
+    JConstructor<jlong, jfloat> ctor { sampleCls };
+    const auto ctorStart = Clock::now();
+    auto constructed = ctor.createArray(t, v);
+    const auto batch = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - ctorStart).count();
+    JFieldConstructor<jlong, jfloat> factory { sampleCls, "t", "v" };
+    const auto allocStart = Clock::now();
+    auto allocated = factory.createArray(t, v);
+    const auto alloc = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - allocStart).count();
+    EXPECT_TRUE(constructed);
+    EXPECT_TRUE(allocated);
+    std::cout << "Construct " << count << " objects: per object " << perObject << " us, constructor handle " << batch << " us, AllocObject " << alloc << " us" << std::endl;
+}
+
+TEST_F(BenchmarkTest, ListPerElementVsToVector)
+{
+    constexpr jint count { 10000 };
+    auto collectionCls = JVM::getEnv().getClass("lv/gusc/jni/tests/CollectionClass");
+    auto list = collectionCls.invokeMethodSign<JList>("createFloatList", "(I)Ljava/util/List;", count);
+    std::vector<jfloat> perElement;
+    const auto perElementStart = Clock::now();
+    const auto size = list.invokeMethod<jint>("size");
+    for (jint i = 0; i < size; ++i)
+    {
+        auto element = list.invokeMethodSign<JObject>("get", "(I)Ljava/lang/Object;", i);
+        perElement.push_back(element.invokeMethod<jfloat>("floatValue"));
+    }
+    const auto byName = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - perElementStart).count();
+    const auto toVectorStart = Clock::now();
+    const auto bulk = list.toVector<jfloat>();
+    const auto toVector = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - toVectorStart).count();
+    EXPECT_EQ(perElement, bulk);
+    std::cout << "List<Float> with " << count << " elements: per element " << byName << " us, toVector " << toVector << " us" << std::endl;
+}
+
+TEST_F(BenchmarkTest, AttachPerTaskVsThreadPool)
+{
+    constexpr int count { 1000 };
+    constexpr int threadCount { 4 };
+    auto obj = cls.createObject().createGlobalRef();
+    std::atomic<jint> sumPerTask { 0 };
+    std::atomic<jint> sumPool { 0 };
+    const auto perTaskStart = Clock::now();
+    for (int batch = 0; batch < count; batch += threadCount)
+    {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back([&]() {
+                // Attached by getEnv, detached when the last JEnv copy goes away
+                auto env = JVM::getEnv();
+                sumPerTask += obj.invokeMethodSign<jint>("args1", "(I)I", 1);
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    const auto perTask = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - perTaskStart).count();
+    JThreadPool pool { threadCount };
+    const auto poolStart = Clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+        pool.post([&](JEnv&) {
+            sumPool += obj.invokeMethodSign<jint>("args1", "(I)I", 1);
+        });
+    }
+    pool.wait();
+    const auto pooled = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - poolStart).count();
+    EXPECT_EQ(sumPerTask.load(), sumPool.load());
+    std::cout << count << " tasks: thread + attach per task " << perTask << " us, thread pool " << pooled << " us" << std::endl;
+}
+
+TEST_F(BenchmarkTest, EventQueuePostLatency)
+{
+    constexpr int producerCount { 4 };
+    constexpr int count { 100000 };
+    auto obj = cls.createObject().createGlobalRef();
+    JMethod<jint(jint)> args1 { cls, "args1" };
+    JEventDispatcher<jint, 4096> events { 1, "JniBenchmarkEvents", std::chrono::microseconds(100) };
+    // Levels are coalesced when the dispatcher can't keep up
+    events.on(0, [&](JEnv& env, const jint& value) {
+        args1.invokeJni(env, obj, value);
+    });
+    events.start();
+    std::atomic<std::int64_t> worstPost { 0 };
+    std::atomic<std::int64_t> totalPost { 0 };
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; ++p)
+    {
+        producers.emplace_back([&]() {
+            std::int64_t worst { 0 };
+            std::int64_t total { 0 };
+            for (int i = 0; i < count; ++i)
+            {
+                const auto start = Clock::now();
+                events.post(0, i);
+                const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+                worst = std::max(worst, elapsed);
+                total += elapsed;
+            }
+            totalPost += total;
+            auto current = worstPost.load();
+            while (current < worst && !worstPost.compare_exchange_weak(current, worst))
+            {
+            }
+        });
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    events.stop();
+    const auto stats = events.getStats();
+    EXPECT_EQ(stats.posted + stats.dropped, static_cast<std::uint64_t>(producerCount * count));
+    EXPECT_EQ(stats.posted, stats.delivered + stats.coalesced);
+    // Direct calls from an attached thread for comparison, real-time threads can't do this
+    auto env = JVM::getEnv();
+    std::int64_t worstDirect { 0 };
+    for (int i = 0; i < iterations; ++i)
+    {
+        const auto start = Clock::now();
+        args1.invokeJni(env, obj, i);
+        worstDirect = std::max<std::int64_t>(worstDirect, std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+    std::cout << producerCount << " x " << count << " posts: average " << totalPost.load() / (producerCount * count) << " ns, worst "
+              << worstPost.load() << " ns (direct call worst " << worstDirect << " ns); delivered " << stats.delivered
+              << ", coalesced " << stats.coalesced << ", dropped " << stats.dropped << ", dispatch latency average "
+              << stats.averageLatency.count() << " ns, worst " << stats.maxLatency.count() << " ns" << std::endl;
+}
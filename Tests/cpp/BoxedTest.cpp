@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+class BoxedTest : public Test
+{
+public:
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/BoxedClass").createGlobalRef() };
+};
+
+TEST_F(BoxedTest, ValueOf)
+{
+    EXPECT_EQ(JInteger::valueOf(42).getValue(), 42);
+    EXPECT_EQ(JLong::valueOf(1LL << 40).getValue(), 1LL << 40);
+    EXPECT_EQ(JFloat::valueOf(0.5f).getValue(), 0.5f);
+    EXPECT_EQ(JDouble::valueOf(0.25).getValue(), 0.25);
+    EXPECT_EQ(JBoolean::valueOf(JNI_TRUE).getValue(), JNI_TRUE);
+    EXPECT_EQ(JCharacter::valueOf('x').getValue(), 'x');
+    EXPECT_EQ(JShort::valueOf(7).getValue(), 7);
+    EXPECT_EQ(JByte::valueOf(8).getValue(), 8);
+    // Small values come from the JVM's valueOf cache
+    auto env = JVM::getEnv();
+    EXPECT_TRUE(env->IsSameObject(JInteger::valueOf(1), JInteger::valueOf(1)));
+    EXPECT_THROW(JInteger().getValue(), std::runtime_error);
+}
+
+TEST_F(BoxedTest, Signature)
+{
+    EXPECT_STREQ(Private::getJTypeSignature<JInteger>().str, "Ljava/lang/Integer;");
+    EXPECT_STREQ((Private::getMethodSignature<JDouble, JBoolean>().str), "(Ljava/lang/Boolean;)Ljava/lang/Double;");
+}
+
+TEST_F(BoxedTest, Invoke)
+{
+    EXPECT_EQ(cls.invokeMethod<JInteger>("increment", JInteger::valueOf(1)).getValue(), 2);
+    EXPECT_EQ(cls.invokeMethod<JDouble>("half", JDouble::valueOf(3.0)).getValue(), 1.5);
+    EXPECT_EQ(cls.invokeMethod<jboolean>("isTrue", JBoolean::valueOf(JNI_TRUE)), JNI_TRUE);
+    EXPECT_FALSE(cls.invokeMethod<JLong>("getNull"));
+}
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+class CollectionTest : public Test
+{
+public:
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/CollectionClass").createGlobalRef() };
+};
+
+TEST_F(CollectionTest, List)
+{
+    auto list = cls.invokeMethodSign<JList>("createFloatList", "(I)Ljava/util/List;", 10);
+    EXPECT_EQ(list.size(), 10);
+    EXPECT_EQ(list.get<jfloat>(3), 1.5f);
+    EXPECT_EQ(list.get<jint>(3), 1);
+    const auto floats = list.toVector<jfloat>();
+    ASSERT_EQ(floats.size(), 10u);
+    EXPECT_EQ(floats[9], 4.5f);
+
+    auto strings = cls.invokeMethodSign<JList>("createStringList", "()Ljava/util/List;");
+    EXPECT_EQ(strings.toVector<std::string>(), (std::vector<std::string>{ "one", "two", "three" }));
+    EXPECT_EQ(static_cast<std::string>(strings.get<JString>(1)), std::string{"two"});
+    EXPECT_EQ(static_cast<std::vector<JObject>>(strings.toArray()).size(), 3u);
+    // Elements of another class are rejected instead of being unboxed
+    EXPECT_THROW(strings.toVector<jint>(), std::runtime_error);
+    EXPECT_THROW(strings.get<jboolean>(0), std::runtime_error);
+    EXPECT_THROW(list.toVector<std::string>(), std::runtime_error);
+    EXPECT_FALSE(JVM::getEnv()->ExceptionCheck());
+}
+
+TEST_F(CollectionTest, Iterator)
+{
+    auto list = cls.invokeMethodSign<JList>("createStringList", "()Ljava/util/List;");
+    std::vector<std::string> values;
+    auto it = list.iterator();
+    while (it.hasNext())
+    {
+        values.push_back(it.next<std::string>());
+    }
+    EXPECT_EQ(values, list.toVector<std::string>());
+}
+
+TEST_F(CollectionTest, Map)
+{
+    auto map = cls.invokeMethodSign<JMap>("createMap", "(I)Ljava/util/Map;", 100);
+    EXPECT_EQ(map.size(), 100);
+    EXPECT_EQ(map.get<jint>(JString::createFrom("key42")), 42);
+    EXPECT_FALSE(map.get<JObject>(JString::createFrom("missing")));
+    EXPECT_THROW(map.get<jint>(JString::createFrom("missing")), std::runtime_error);
+
+    const auto values = map.toUnorderedMap<std::string, jint>();
+    ASSERT_EQ(values.size(), 100u);
+    EXPECT_EQ(values.at("key7"), 7);
+    EXPECT_EQ((map.toVector<std::string, jlong>().size()), 100u);
+    EXPECT_EQ(map.entrySet().size(), 100);
+}
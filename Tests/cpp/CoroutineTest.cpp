@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+
+#if defined(GUSC_JNI_COROUTINES)
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <string>
+#include <thread>
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+namespace
+{
+/// @brief Minimal eagerly started coroutine, the promise result is exposed as std::future
+template<typename T>
+struct Task
+{
+    struct promise_type
+    {
+        std::promise<T> promise;
+
+        Task get_return_object()
+        {
+            return Task { promise.get_future() };
+        }
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_value(T value)
+        {
+            promise.set_value(std::move(value));
+        }
+        void unhandled_exception()
+        {
+            promise.set_exception(std::current_exception());
+        }
+    };
+
+    std::future<T> result;
+};
+}
+
+class CoroutineTest : public Test
+{
+public:
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/FutureClass").createGlobalRef() };
+};
+
+TEST_F(CoroutineTest, Completed)
+{
+    const auto caller = std::this_thread::get_id();
+    auto task = [](JClass cls, std::thread::id caller) -> Task<jint> {
+        auto future = cls.invokeMethod<JCompletableFuture>("completed", 42);
+        const auto value = co_await future.await<jint>();
+        // Completed futures don't suspend
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        co_return value;
+    }(cls, caller);
+    EXPECT_EQ(task.result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_EQ(task.result.get(), 42);
+}
+
+TEST_F(CoroutineTest, Pending)
+{
+    const auto caller = std::this_thread::get_id();
+    auto task = [](JClass cls, std::thread::id caller) -> Task<std::string> {
+        auto future = cls.invokeMethod<JCompletableFuture>("delayed", JString::createFrom("preset"), 50);
+        auto value = co_await future.await<JString>();
+        // Resumed inline on the Java thread that completed the future
+        EXPECT_NE(std::this_thread::get_id(), caller);
+        EXPECT_NE(JVM::getScopedEnv(), nullptr);
+        co_return static_cast<std::string>(value);
+    }(cls, caller);
+    ASSERT_EQ(task.result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(task.result.get(), "preset");
+}
+
+TEST_F(CoroutineTest, ResumeOnPool)
+{
+    JThreadPool pool { 1, "JniCoroutine" };
+    auto task = [](JClass cls, JThreadPool& pool) -> Task<std::string> {
+        auto future = cls.invokeMethod<JCompletableFuture>("delayed", JString::createFrom("pool"), 10);
+        auto value = co_await future.await<std::string>(resumeOn(pool));
+        auto thread = JVM::getEnv().getClass("java/lang/Thread").invokeMethodSign<JObject>("currentThread", "()Ljava/lang/Thread;");
+        EXPECT_EQ(static_cast<std::string>(thread.invokeMethod<JString>("getName")), "JniCoroutine-0");
+        co_return value;
+    }(cls, pool);
+    ASSERT_EQ(task.result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(task.result.get(), "pool");
+}
+
+TEST_F(CoroutineTest, Exceptional)
+{
+    auto failed = [](JClass cls) -> Task<jint> {
+        auto future = cls.invokeMethod<JCompletableFuture>("failed", JString::createFrom("failed"));
+        co_return co_await future.await<jint>();
+    }(cls);
+    EXPECT_THROW(failed.result.get(), JIllegalStateException);
+    // CompletionException thrown by asynchronous stages is unwrapped
+    auto delayed = [](JClass cls) -> Task<jint> {
+        auto future = cls.invokeMethod<JCompletableFuture>("failedDelayed", JString::createFrom("delayed"), 10);
+        co_return co_await future.await<jint>();
+    }(cls);
+    ASSERT_EQ(delayed.result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_THROW(delayed.result.get(), JIllegalStateException);
+}
+
+#endif
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+enum class FilterType
+{
+    LowPass = 10,
+    HighPass = 20,
+    BandPass = 30
+};
+
+template<>
+struct gusc::Jni::JEnumTraits<FilterType>
+{
+    static constexpr const char* getClassName()
+    {
+        return "lv.gusc.jni.tests.FilterType";
+    }
+    static constexpr JEnumConstant<FilterType> constants[] {
+        { FilterType::LowPass, "LOW_PASS" },
+        { FilterType::HighPass, "HIGH_PASS" },
+        { FilterType::BandPass, "BAND_PASS" }
+    };
+};
+
+class EnumTest : public Test
+{
+public:
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/EnumClass").createGlobalRef() };
+};
+
+TEST_F(EnumTest, Signature)
+{
+    EXPECT_STREQ(Private::getJTypeSignature<FilterType>().str, "Llv/gusc/jni/tests/FilterType;");
+    EXPECT_STREQ((Private::getMethodSignature<jint, FilterType>().str), "(Llv/gusc/jni/tests/FilterType;)I");
+    EXPECT_STREQ(Private::getJTypeSignature<JEnum<FilterType>>().str, "Llv/gusc/jni/tests/FilterType;");
+}
+
+TEST_F(EnumTest, Mapping)
+{
+    JEnumMapping<FilterType>::load();
+    EXPECT_EQ(JEnumMapping<FilterType>::getOrdinal(FilterType::LowPass), 0);
+    EXPECT_EQ(JEnumMapping<FilterType>::getOrdinal(FilterType::BandPass), 2);
+    EXPECT_EQ(JEnumMapping<FilterType>::fromOrdinal(1), FilterType::HighPass);
+    EXPECT_EQ(JEnumMapping<FilterType>::fromJni(JEnumMapping<FilterType>::toJni(FilterType::BandPass)), FilterType::BandPass);
+    EXPECT_THROW(JEnumMapping<FilterType>::toJni(static_cast<FilterType>(0)), std::invalid_argument);
+    EXPECT_THROW(JEnumMapping<FilterType>::fromOrdinal(3), std::out_of_range);
+    EXPECT_THROW(JEnumMapping<FilterType>::fromJni(nullptr), std::invalid_argument);
+}
+
+TEST_F(EnumTest, Invoke)
+{
+    EXPECT_EQ(cls.invokeMethod<jint>("getOrdinal", FilterType::HighPass), 1);
+    EXPECT_EQ(cls.invokeMethod<JEnum<FilterType>>("getHighPass").getValue(), FilterType::HighPass);
+    EXPECT_EQ(cls.invokeMethod<JEnum<FilterType>>("next", FilterType::BandPass).getValue(), FilterType::LowPass);
+    EXPECT_EQ(cls.invokeMethod<JEnum<FilterType>>("next", JEnum<FilterType>(FilterType::LowPass)).getValue(), FilterType::HighPass);
+}
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+TEST(EnvTest, Scope)
+{
+    auto env = JVM::getEnv();
+    JNIEnv* jniEnv = env;
+    EXPECT_EQ(JVM::getScopedEnv(), nullptr);
+    {
+        JEnvScope scope { jniEnv };
+        EXPECT_EQ(JVM::getScopedEnv(), jniEnv);
+        auto scopedEnv = JVM::getEnv();
+        EXPECT_EQ(static_cast<JNIEnv*>(scopedEnv), jniEnv);
+        {
+            JEnvScope nested { jniEnv };
+            EXPECT_EQ(JVM::getScopedEnv(), jniEnv);
+        }
+        EXPECT_EQ(JVM::getScopedEnv(), jniEnv);
+        // Scope is thread local
+        std::thread([]() {
+            EXPECT_EQ(JVM::getScopedEnv(), nullptr);
+        }).join();
+    }
+    EXPECT_EQ(JVM::getScopedEnv(), nullptr);
+}
+
+TEST(EnvTest, JniOverloads)
+{
+    auto env = JVM::getEnv();
+    auto cls = env.getClass("lv/gusc/jni/tests/TestClass");
+    EXPECT_EQ(cls.getClassPathJni(env), std::string{"lv/gusc/jni/tests/TestClass"});
+    auto obj = cls.createObject();
+    auto global = obj.createGlobalRefJni(env);
+    EXPECT_EQ(env->GetObjectRefType(global), JNIGlobalRefType);
+    auto str = JString::createFrom(env, "test");
+    EXPECT_EQ(str.getStringJni(env), std::string{"test"});
+    auto arr = JIntArray::createFrom(env, { 1, 2, 3 });
+    EXPECT_EQ(arr.getDataJni(env)[1], 2);
+    auto objArr = JObjectArray::createNewJni(env, 2, obj, cls);
+    EXPECT_EQ(objArr.toVectorJni(env).size(), 2u);
+    EXPECT_TRUE(env->IsSameObject(objArr.getElementJni(env, 1), obj));
+}
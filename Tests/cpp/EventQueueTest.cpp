@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+namespace
+{
+enum EventType : std::uint32_t
+{
+    Level,
+    State,
+    EventTypeCount
+};
+
+struct Payload
+{
+    jint channel;
+    jfloat value;
+};
+}
+
+class EventQueueTest : public Test
+{
+public:
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/EventClass").createGlobalRef() };
+    JMethod<void(jint, jfloat)> onLevel { cls, "onLevel" };
+    JMethod<void(jint)> onState { cls, "onState" };
+};
+
+TEST_F(EventQueueTest, Queue)
+{
+    JEventQueue<jint, 4> queue;
+    EXPECT_EQ(queue.capacity(), 4u);
+    for (jint i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.tryPush({ 0, 0, i }));
+    }
+    // Full queue drops instead of blocking
+    EXPECT_FALSE(queue.tryPush({ 0, 0, 4 }));
+    EXPECT_EQ(queue.size(), 4u);
+    JEvent<jint> event;
+    for (jint i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.tryPop(event));
+        EXPECT_EQ(event.payload, i);
+    }
+    EXPECT_FALSE(queue.tryPop(event));
+    // Slots are reused on the next lap
+    EXPECT_TRUE(queue.tryPush({ 0, 0, 5 }));
+    ASSERT_TRUE(queue.tryPop(event));
+    EXPECT_EQ(event.payload, 5);
+}
+
+TEST_F(EventQueueTest, MultipleProducers)
+{
+    constexpr jint producerCount { 4 };
+    constexpr jint count { 10000 };
+    JEventQueue<jint, 256> queue;
+    std::vector<std::thread> producers;
+    for (jint p = 0; p < producerCount; ++p)
+    {
+        producers.emplace_back([&queue, p]() {
+            for (jint i = 0; i < count; ++i)
+            {
+                while (!queue.tryPush({ static_cast<std::uint32_t>(p), 0, i }))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    // Every event arrives once and in order per producer
+    std::vector<jint> next(producerCount, 0);
+    JEvent<jint> event;
+    for (jint received = 0; received < producerCount * count;)
+    {
+        if (queue.tryPop(event))
+        {
+            EXPECT_EQ(event.payload, next[event.type]);
+            ++next[event.type];
+            ++received;
+        }
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST_F(EventQueueTest, Dispatch)
+{
+    auto listener = cls.createObject().createGlobalRef();
+    {
+        JEventDispatcher<Payload, 64> events { EventTypeCount, "JniTestEvents" };
+        events.on(Level, [&](JEnv& env, const Payload& payload) {
+            onLevel.invokeJni(env, listener, payload.channel, payload.value);
+        });
+        events.on(State, [&](JEnv& env, const Payload& payload) {
+            onState.invokeJni(env, listener, payload.channel);
+        }, false);
+        events.start();
+        EXPECT_TRUE(events.isRunning());
+        EXPECT_THROW(events.on(Level, nullptr), std::runtime_error);
+        // Posted from a thread that is never attached to the JVM
+        std::thread producer([&events]() {
+            for (jint i = 1; i <= 10; ++i)
+            {
+                EXPECT_TRUE(events.post(State, { i, 0.0f }));
+                EXPECT_TRUE(events.post(Level, { 0, static_cast<jfloat>(i) }));
+            }
+            EXPECT_FALSE(events.post(EventTypeCount, { 0, 0.0f }));
+        });
+        producer.join();
+        events.stop();
+        const auto stats = events.getStats();
+        EXPECT_EQ(stats.posted, 20u);
+        EXPECT_EQ(stats.dropped, 1u);
+        EXPECT_EQ(stats.delivered + stats.coalesced, 20u);
+        EXPECT_GE(stats.maxLatency, stats.averageLatency);
+    }
+    // State changes are never coalesced, levels may be but the latest one always arrives
+    EXPECT_EQ(listener.invokeMethod<jint>("getStateCount"), 10);
+    EXPECT_EQ(listener.invokeMethod<jint>("getLastState"), 10);
+    EXPECT_GE(listener.invokeMethod<jint>("getLevelCount"), 1);
+    EXPECT_EQ(listener.invokeMethod<jfloat>("getLastLevel"), 10.0f);
+}
+
+TEST_F(EventQueueTest, Coalesce)
+{
+    auto listener = cls.createObject().createGlobalRef();
+    // Events posted before start() are drained in one batch
+    JEventDispatcher<Payload, 64> events { EventTypeCount };
+    events.on(Level, [&](JEnv& env, const Payload& payload) {
+        onLevel.invokeJni(env, listener, payload.channel, payload.value);
+    });
+    for (jint i = 1; i <= 100; ++i)
+    {
+        events.post(Level, { 0, static_cast<jfloat>(i) });
+    }
+    auto stats = events.getStats();
+    EXPECT_EQ(stats.posted, 64u);
+    EXPECT_EQ(stats.dropped, 36u);
+    events.start();
+    events.stop();
+    stats = events.getStats();
+    EXPECT_EQ(stats.delivered, 1u);
+    EXPECT_EQ(stats.coalesced, 63u);
+    EXPECT_EQ(listener.invokeMethod<jint>("getLevelCount"), 1);
+    EXPECT_EQ(listener.invokeMethod<jfloat>("getLastLevel"), 64.0f);
+}
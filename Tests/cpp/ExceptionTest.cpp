@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+namespace
+{
+class CustomException : public JIllegalStateException
+{
+public:
+    using JIllegalStateException::JIllegalStateException;
+};
+}
+
+class ExceptionTest : public Test
+{
+public:
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/ExceptionClass").createGlobalRef() };
+};
+
+TEST_F(ExceptionTest, Typed)
+{
+    EXPECT_THROW(cls.invokeMethod<void>("throwRuntime", JString::createFrom("runtime")), JRuntimeException);
+    EXPECT_THROW(cls.invokeMethod<void>("throwIllegalArgument", JString::createFrom("argument")), JIllegalArgumentException);
+    EXPECT_THROW(cls.invokeMethod<void>("throwIllegalState", JString::createFrom("state")), JIllegalStateException);
+    // Everything is still a std::runtime_error
+    EXPECT_THROW(cls.invokeMethod<void>("throwIllegalState", JString::createFrom("state")), std::runtime_error);
+    // Unregistered exceptions are thrown as JException
+    try
+    {
+        cls.invokeMethod<void>("throwChecked", JString::createFrom("checked"));
+        FAIL();
+    }
+    catch (const JRuntimeException&)
+    {
+        FAIL();
+    }
+    catch (const JException& e)
+    {
+        EXPECT_EQ(e.getClassName(), std::string{"java.lang.Exception"});
+    }
+}
+
+TEST_F(ExceptionTest, Registry)
+{
+    // Subclass of a built-in exception is unknown until registered
+    try
+    {
+        cls.invokeMethod<void>("throwCustom", JString::createFrom("custom"));
+        FAIL();
+    }
+    catch (const CustomException&)
+    {
+        FAIL();
+    }
+    catch (const JIllegalStateException&)
+    {}
+    JExceptionRegistry::registerException<CustomException>("lv/gusc/jni/tests/CustomException");
+    EXPECT_THROW(cls.invokeMethod<void>("throwCustom", JString::createFrom("custom")), CustomException);
+    EXPECT_THROW(cls.invokeMethod<void>("throwIllegalState", JString::createFrom("state")), JIllegalStateException);
+}
+
+TEST_F(ExceptionTest, Metadata)
+{
+    try
+    {
+        cls.invokeMethod<void>("throwIllegalArgument", JString::createFrom("bad argument"));
+        FAIL();
+    }
+    catch (const JException& e)
+    {
+        EXPECT_NE(e.getThrowable(), nullptr);
+        EXPECT_EQ(e.getMessage(), std::string{"bad argument"});
+        EXPECT_STREQ(e.what(), "JNI Exception occured: bad argument");
+        EXPECT_EQ(e.getClassName(), std::string{"java.lang.IllegalArgumentException"});
+        const auto stackTrace = e.getStackTrace();
+        EXPECT_EQ(stackTrace.find("java.lang.IllegalArgumentException: bad argument"), 0u);
+        EXPECT_NE(stackTrace.find("throwIllegalArgument"), std::string::npos);
+    }
+    // Wrappers can be used after the exception was translated
+    EXPECT_EQ(static_cast<std::string>(JString::createFrom("ok")), std::string{"ok"});
+}
+
+TEST_F(ExceptionTest, Constructor)
+{
+    JConstructor<jint> ctor { cls };
+    EXPECT_THROW(ctor(1), JIllegalArgumentException);
+    EXPECT_FALSE(JVM::getEnv()->ExceptionCheck());
+    EXPECT_THROW(cls.createObject(1), JIllegalArgumentException);
+    EXPECT_FALSE(JVM::getEnv()->ExceptionCheck());
+}
+
+TEST_F(ExceptionTest, Batch)
+{
+    auto env = JVM::getEnv();
+    const auto methodId = cls.getStaticMethodIdJni(env, "throwIllegalState", "(Ljava/lang/String;)V");
+    const auto message = JString::createFrom("state");
+    EXPECT_THROW({
+        JExceptionBatch batch { env };
+        EXPECT_TRUE(JExceptionBatch::isActive());
+        cls.invokeMethodJni<void>(env, methodId, message);
+    }, JIllegalStateException);
+    EXPECT_FALSE(JExceptionBatch::isActive());
+    EXPECT_FALSE(env->ExceptionCheck());
+    {
+        JExceptionBatch batch { env };
+        EXPECT_EQ(static_cast<std::string>(JString::createFrom("ok")), std::string{"ok"});
+    }
+#if !defined(NDEBUG)
+    // Debug builds reject a call made over a pending Java exception before it reaches Java
+    bool reached { false };
+    EXPECT_THROW({
+        JExceptionBatch batch { env };
+        cls.invokeMethodJni<void>(env, methodId, message);
+        cls.invokeMethodJni<void>(env, methodId, message);
+        reached = true;
+    }, std::logic_error);
+    EXPECT_FALSE(reached);
+    EXPECT_FALSE(env->ExceptionCheck());
+#endif
+}
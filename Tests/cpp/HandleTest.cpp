@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+namespace
+{
+struct InstanceFields
+{
+    jboolean booleanField;
+    jint intField;
+    jlong longField;
+    jdouble doubleField;
+    JString stringField;
+};
+}
+
+class HandleTest : public Test
+{
+public:
+    JClass instanceCls { JVM::getEnv().getClass("lv/gusc/jni/tests/InstanceClass").createGlobalRef() };
+    JClass staticCls { JVM::getEnv().getClass("lv/gusc/jni/tests/StaticClass").createGlobalRef() };
+    JClass testCls { JVM::getEnv().getClass("lv/gusc/jni/tests/TestClass").createGlobalRef() };
+};
+
+TEST_F(HandleTest, Method)
+{
+    JMethod<void(jint)> setInt { instanceCls, "setInt" };
+    JMethod<jint()> getInt { instanceCls, "getInt" };
+    JMethod<void(JString)> setString { instanceCls, "setString" };
+    JMethod<JString()> getString { instanceCls, "getString" };
+    EXPECT_TRUE(setInt);
+    EXPECT_STREQ(setInt.getSignature(), "(I)V");
+    EXPECT_STREQ(getString.getSignature(), "()Ljava/lang/String;");
+
+    auto obj1 = instanceCls.createObject();
+    auto obj2 = instanceCls.createObject();
+    setInt(obj1, 1);
+    setInt(obj2, 2);
+    setString(obj1, JString::createFrom("one"));
+    EXPECT_EQ(getInt(obj1), 1);
+    EXPECT_EQ(getInt(obj2), 2);
+    EXPECT_EQ(static_cast<std::string>(getString(obj1)), std::string{"one"});
+
+    JMethod<jint()> unresolved;
+    EXPECT_FALSE(unresolved);
+    EXPECT_THROW(JMethod<jint()>(instanceCls, "noSuchMethod"), std::runtime_error);
+}
+
+TEST_F(HandleTest, StaticMethod)
+{
+    JStaticMethod<void(jint)> setInt { staticCls, "setInt" };
+    JStaticMethod<jint()> getInt { staticCls, "getInt" };
+    const auto original = getInt();
+    setInt(42);
+    EXPECT_EQ(getInt(), 42);
+    setInt(original);
+}
+
+TEST_F(HandleTest, Constructor)
+{
+    JConstructor<> ctor { testCls };
+    JConstructor<JString> ctorString { testCls };
+    JMethod<JString()> getString { testCls, "getString" };
+    EXPECT_EQ(static_cast<std::string>(getString(ctor())), std::string{"ASDF"});
+    EXPECT_EQ(static_cast<std::string>(getString(ctorString(JString::createFrom("TEST")))), std::string{"TEST"});
+}
+
+TEST_F(HandleTest, Field)
+{
+    JField<jint> intField { instanceCls, "intField" };
+    JField<JString> stringField { instanceCls, "stringField" };
+    EXPECT_TRUE(intField);
+    EXPECT_STREQ(intField.getSignature(), "I");
+    EXPECT_STREQ(stringField.getSignature(), "Ljava/lang/String;");
+
+    auto obj1 = instanceCls.createObject();
+    auto obj2 = instanceCls.createObject();
+    intField.set(obj1, 1);
+    intField.set(obj2, 2);
+    stringField.set(obj1, JString::createFrom("one"));
+    EXPECT_EQ(intField.get(obj1), 1);
+    EXPECT_EQ(intField.get(obj2), 2);
+    EXPECT_EQ(static_cast<std::string>(stringField.get(obj1)), std::string{"one"});
+    EXPECT_EQ(static_cast<std::string>(stringField.get(obj2)), std::string{"asdf"});
+
+    JField<jint> unresolved;
+    EXPECT_FALSE(unresolved);
+    EXPECT_THROW(JField<jint>(instanceCls, "noSuchField"), std::runtime_error);
+}
+
+TEST_F(HandleTest, StaticField)
+{
+    JStaticField<jint> intField { staticCls, "intField" };
+    JStaticField<JString> stringField { staticCls, "stringField" };
+    const auto original = intField.get();
+    intField.set(42);
+    EXPECT_EQ(intField.get(), 42);
+    EXPECT_EQ(staticCls.getField<jint>("intField"), 42);
+    intField.set(original);
+    EXPECT_EQ(static_cast<std::string>(stringField.get()), std::string{"asdf"});
+}
+
+TEST_F(HandleTest, StructMapping)
+{
+    JStructMapping mapping {
+        instanceCls,
+        mapField(&InstanceFields::booleanField, "booleanField"),
+        mapField(&InstanceFields::intField, "intField"),
+        mapField(&InstanceFields::longField, "longField"),
+        mapField(&InstanceFields::doubleField, "doubleField"),
+        mapField(&InstanceFields::stringField, "stringField")
+    };
+    EXPECT_EQ(mapping.size(), 5u);
+
+    auto obj = instanceCls.createObject();
+    auto fields = mapping.load(obj);
+    EXPECT_EQ(fields.booleanField, JNI_TRUE);
+    EXPECT_EQ(fields.intField, 0x7FFFFFFF);
+    EXPECT_EQ(fields.doubleField, 2.0);
+    EXPECT_EQ(static_cast<std::string>(fields.stringField), std::string{"asdf"});
+
+    fields.booleanField = JNI_FALSE;
+    fields.intField = 1;
+    fields.longField = 2;
+    fields.doubleField = 3.0;
+    fields.stringField = JString::createFrom("four");
+    mapping.store(fields, obj);
+    EXPECT_EQ(obj.getField<jboolean>("booleanField"), JNI_FALSE);
+    EXPECT_EQ(obj.getField<jint>("intField"), 1);
+    EXPECT_EQ(obj.getField<jlong>("longField"), 2);
+    EXPECT_EQ(obj.getField<jdouble>("doubleField"), 3.0);
+    EXPECT_EQ(static_cast<std::string>(obj.getField<JString>("stringField")), std::string{"four"});
+
+    InstanceFields copy {};
+    mapping.load(obj, copy);
+    EXPECT_EQ(copy.longField, 2);
+
+    EXPECT_THROW(JStructMapping(instanceCls, mapField(&InstanceFields::intField, "noSuchField")), std::runtime_error);
+}
+
+TEST_F(HandleTest, ColumnExtractor)
+{
+    constexpr jint count { 1000 };
+    auto sampleCls = JVM::getEnv().getClass("lv/gusc/jni/tests/SampleClass");
+    JColumnExtractor<jlong, jfloat> extractor { sampleCls, "t", "v" };
+    JObjectArray samples { sampleCls.invokeMethodSign<jobjectArray>("createArray", "(I)[Llv/gusc/jni/tests/SampleClass;", count) };
+
+    auto [t, v] = extractor.extract(samples);
+    ASSERT_EQ(t.size(), static_cast<std::size_t>(count));
+    ASSERT_EQ(v.size(), static_cast<std::size_t>(count));
+    EXPECT_EQ(t[10], 10);
+    EXPECT_EQ(v[10], 5.f);
+    EXPECT_EQ(t[count - 1], count - 1);
+
+    auto threaded = extractor.extract(samples, 4);
+    EXPECT_EQ(std::get<0>(threaded), t);
+    EXPECT_EQ(std::get<1>(threaded), v);
+    JThreadPool pool { 3, "JniTestExtract" };
+    auto pooled = extractor.extract(pool, samples);
+    EXPECT_EQ(std::get<0>(pooled), t);
+    EXPECT_EQ(std::get<1>(pooled), v);
+
+    auto list = sampleCls.invokeMethodSign<JObject>("createList", "(I)Ljava/util/List;", count);
+    auto fromList = extractor.extractCollection(list);
+    EXPECT_EQ(std::get<0>(fromList), t);
+    EXPECT_EQ(std::get<1>(extractor.extractCollection(pool, list)), v);
+
+    EXPECT_THROW(extractor.extractCollection(sampleCls.createObject(static_cast<jlong>(1), 1.f)), std::runtime_error);
+    // Elements of untyped arrays are checked against the bound class
+    auto mixed = sampleCls.invokeMethodSign<JObject>("createMixedList", "(I)Ljava/util/List;", count);
+    EXPECT_THROW(extractor.extractCollection(mixed), std::runtime_error);
+    EXPECT_THROW(extractor.extractCollection(pool, mixed), std::runtime_error);
+}
+
+TEST_F(HandleTest, ConstructorArray)
+{
+    auto sampleCls = JVM::getEnv().getClass("lv/gusc/jni/tests/SampleClass");
+    JColumnExtractor<jlong, jfloat> extractor { sampleCls, "t", "v" };
+    const std::vector<jlong> t { 1, 2, 3 };
+    const std::vector<jfloat> v { 0.5f, 1.5f, 2.5f };
+
+    JConstructor<jlong, jfloat> ctor { sampleCls };
+    auto constructed = ctor.createArray(t, v);
+    EXPECT_EQ(std::get<0>(extractor.extract(constructed)), t);
+    EXPECT_EQ(std::get<1>(extractor.extract(constructed)), v);
+
+    JFieldConstructor<jlong, jfloat> factory { sampleCls, "t", "v" };
+    auto allocated = factory.createArray(t, v);
+    EXPECT_EQ(std::get<0>(extractor.extract(allocated)), t);
+    EXPECT_EQ(std::get<1>(extractor.extract(allocated)), v);
+    auto obj = factory(static_cast<jlong>(7), 8.f);
+    EXPECT_EQ(obj.getField<jlong>("t"), 7);
+
+    EXPECT_THROW(ctor.createArray(t, std::vector<jfloat>{}), std::invalid_argument);
+    EXPECT_THROW(JFieldConstructor<jint>(sampleCls, "t"), std::runtime_error);
+}
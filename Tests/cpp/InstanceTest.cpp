@@ -10,6 +10,7 @@ using namespace gusc::Jni;
 using namespace ::testing;
 
 constexpr const char lv_gusc_jni_tests_TestClass[] = "lv.gusc.jni.tests.TestClass";
+constexpr const char lv_gusc_jni_tests_BaseClass[] = "lv.gusc.jni.tests.BaseClass";
 
 class InstanceTest : public Test
 {
@@ -248,6 +249,72 @@ TEST_F(InstanceTest, Invoke)
     EXPECT_EQ(static_cast<std::string>(test4.invokeMethod<JString>("getString")), std::string{"TEST"});
 }
 
+TEST_F(InstanceTest, InvokeJValue)
+{
+    auto obj = cls.createObject();
+    obj.invokeMethodA<void>("voidMethod", a, b, c, d, e, f, g, h, i);
+    obj.invokeMethodA<void>("setIntArray", static_cast<jintArray>(n));
+    auto a1 = obj.invokeMethodA<jboolean>("getBoolean");
+    auto b1 = obj.invokeMethodA<jbyte>("getByte");
+    auto c1 = obj.invokeMethodA<jchar>("getChar");
+    auto d1 = obj.invokeMethodA<jshort>("getShort");
+    auto e1 = obj.invokeMethodA<jint>("getInt");
+    auto f1 = obj.invokeMethodA<jlong>("getLong");
+    auto g1 = obj.invokeMethodA<jfloat>("getFloat");
+    auto h1 = obj.invokeMethodA<jdouble>("getDouble");
+    auto i1 = obj.invokeMethodA<JString>("getString");
+    auto n1 = obj.invokeMethodA<jintArray>("getIntArray");
+    EXPECT_EQ(a, a1);
+    EXPECT_EQ(b, b1);
+    EXPECT_EQ(c, c1);
+    EXPECT_EQ(d, d1);
+    EXPECT_EQ(e, e1);
+    EXPECT_EQ(f, f1);
+    EXPECT_EQ(g, g1);
+    EXPECT_EQ(h, h1);
+    EXPECT_TRUE(compare(i, i1));
+    EXPECT_TRUE(compare(n, n1));
+}
+
+TEST_F(InstanceTest, InvokeNonvirtual)
+{
+    auto derivedCls = JVM::getEnv().getClass("lv/gusc/jni/tests/DerivedClass");
+    auto baseCls = JVM::getEnv().getClass("lv/gusc/jni/tests/BaseClass");
+    auto obj = derivedCls.createObject();
+    EXPECT_EQ(obj.invokeMethod<jint>("getValue"), 2);
+    EXPECT_EQ(obj.invokeNonvirtual<jint>(derivedCls, "getValue"), 2);
+    EXPECT_EQ(obj.invokeNonvirtual<jint>(baseCls, "getValue"), 1);
+    EXPECT_EQ(static_cast<std::string>(obj.invokeNonvirtual<JString>(baseCls, "getName")), std::string{"base"});
+
+    // Resolved once against the base class
+    JMethod<jint()> getValue { baseCls, "getValue" };
+    JMethod<JString()> getName { baseCls, "getName" };
+    EXPECT_EQ(getValue(obj), 2);
+    EXPECT_EQ(getValue.invokeNonvirtual(obj), 1);
+    EXPECT_EQ(static_cast<std::string>(getName.invokeNonvirtual(obj)), std::string{"base"});
+}
+
+TEST_F(InstanceTest, InvokeCached)
+{
+    auto derivedCls = JVM::getEnv().getClass("lv/gusc/jni/tests/DerivedClass");
+    auto baseCls = JVM::getEnv().getClass("lv/gusc/jni/tests/BaseClass");
+    std::vector<JObjectS<lv_gusc_jni_tests_BaseClass>> receivers;
+    receivers.emplace_back(baseCls.createObject());
+    receivers.emplace_back(derivedCls.createObject());
+    receivers.emplace_back(baseCls.createObject());
+    std::vector<jint> expected { 1, 2, 1 };
+
+    JMethodCache<jint()> polymorphic { "getValue" };
+    JMethodCache<jint(), 1> monomorphic { "getValue" };
+    for (std::size_t idx = 0; idx < receivers.size(); ++idx)
+    {
+        EXPECT_EQ(receivers[idx].invokeMethodCached(polymorphic), expected[idx]);
+        EXPECT_EQ(receivers[idx].invokeMethodCached(monomorphic), expected[idx]);
+    }
+    EXPECT_EQ(polymorphic.getSize(), 2u);
+    EXPECT_EQ(monomorphic.getSize(), 1u);
+}
+
 TEST_F(InstanceTest, Fields)
 {
     auto obj = cls.createObject();
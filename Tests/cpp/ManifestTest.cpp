@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+namespace
+{
+constexpr const char lv_gusc_jni_tests_StaticClass[] = "lv.gusc.jni.tests.StaticClass";
+constexpr const char lv_gusc_jni_tests_TestClass[] = "lv.gusc.jni.tests.TestClass";
+constexpr const char lv_gusc_jni_tests_MissingClass[] = "lv.gusc.jni.tests.MissingClass";
+}
+
+TEST(ManifestTest, Resolve)
+{
+    JStaticMethod<jint()> getInt;
+    JStaticField<jint> intField;
+    JStaticConstant<jint> bufferSize;
+    JConstructor<> constructor;
+    JMethod<JString()> getString;
+    JMethod<void()> callMe;
+    JManifest manifest;
+    manifest
+        .addClass<lv_gusc_jni_tests_StaticClass>()
+        .add<lv_gusc_jni_tests_StaticClass>(getInt, "getInt")
+        .add<lv_gusc_jni_tests_StaticClass>(intField, "intField")
+        .add<lv_gusc_jni_tests_StaticClass>(bufferSize, "BUFFER_SIZE")
+        .add<lv_gusc_jni_tests_TestClass>(constructor)
+        .add<lv_gusc_jni_tests_TestClass>(getString, "getString")
+        .add<lv_gusc_jni_tests_TestClass>(callMe, "callMe");
+    EXPECT_EQ(manifest.size(), 7u);
+    const auto report = manifest.resolveOrThrow();
+    EXPECT_FALSE(report.hasErrors());
+    EXPECT_EQ(report.entries.size(), 7u);
+    EXPECT_EQ(report.entries[1].kind, "static method");
+    EXPECT_EQ(report.entries[1].name, "getInt");
+    EXPECT_TRUE(getInt);
+    EXPECT_TRUE(intField);
+    EXPECT_TRUE(constructor);
+    EXPECT_TRUE(getString);
+    EXPECT_TRUE(callMe);
+    EXPECT_EQ(bufferSize.get(), 512);
+    EXPECT_EQ(static_cast<std::string>(getString(constructor())), "ASDF");
+}
+
+TEST(ManifestTest, Errors)
+{
+    JStaticMethod<jint()> missingMethod;
+    JField<jint> missingField;
+    JManifest manifest;
+    manifest
+        .add<lv_gusc_jni_tests_StaticClass>(missingMethod, "missingMethod")
+        .add<lv_gusc_jni_tests_TestClass>(missingField, "missingField")
+        .addClass<lv_gusc_jni_tests_MissingClass>();
+    const auto report = manifest.resolve();
+    EXPECT_TRUE(report.hasErrors());
+    EXPECT_EQ(report.entries.size(), 3u);
+    for (const auto& entry : report.entries)
+    {
+        EXPECT_FALSE(entry.error.empty());
+    }
+    EXPECT_NE(report.getErrors().find("missingField"), std::string::npos);
+    EXPECT_FALSE(missingMethod);
+    EXPECT_THROW(manifest.resolveOrThrow(), std::runtime_error);
+    EXPECT_FALSE(JVM::getEnv()->ExceptionCheck());
+}
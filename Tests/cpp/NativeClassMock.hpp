@@ -11,36 +11,13 @@
 using namespace gusc::Jni;
 using namespace ::testing;
 
-// C++20 will have this built-in:
-#if __cplusplus <= 201703L
-template<class To, class From>
-typename std::enable_if_t<
-        sizeof(To) == sizeof(From) &&
-        std::is_trivially_copyable_v<From> &&
-        std::is_trivially_copyable_v<To>,
-        To>
-bit_cast(const From& src) noexcept
+struct NativeCustomError : public std::exception
 {
-    static_assert(std::is_trivially_constructible_v<To>, "This implementation additionally requires destination type to be trivially constructible");
-    To dst;
-    std::memcpy(&dst, &src, sizeof(To));
-    return dst;
-}
-#endif
-
-namespace
-{
-template<typename T>
-inline T* toPtr(jlong ptrVal)
-{
-    return bit_cast<T*>(static_cast<uintptr_t>(ptrVal));
-}
-template<typename T>
-inline jlong fromPtr(T* ptr)
-{
-    return static_cast<jlong>(bit_cast<uintptr_t>(ptr));
-}
-}
+    const char* what() const noexcept override
+    {
+        return "custom error";
+    }
+};
 
 constexpr const char lv_gusc_jni_tests_InstanceClass[] = "lv.gusc.jni.tests.InstanceClass";
 
@@ -48,9 +25,25 @@ class NativeClassMock
 {
 public:
     NativeClassMock()
-        : objRef(JVM::getEnv().getClass("lv/gusc/jni/tests/NativeClass").createObject(fromPtr(this)))
+        : handle(JNativePeer<NativeClassMock>::attach(this))
+        , objRef(JVM::getEnv().getClass("lv/gusc/jni/tests/NativeClass").createObject(handle))
     {}
 
+    ~NativeClassMock()
+    {
+        JNativePeer<NativeClassMock>::detach(handle);
+    }
+
+    jlong getHandle() const
+    {
+        return handle;
+    }
+
+    jobject getObject()
+    {
+        return objRef;
+    }
+
     JObjectS<lv_gusc_jni_tests_InstanceClass> getInstance()
     {
         return objRef->invokeMethod<JObjectS<lv_gusc_jni_tests_InstanceClass>>("getInstance");
@@ -156,33 +149,44 @@ public:
         return objRef->invokeMethod<jdoubleArray>("doubleArrayMethod", val);
     }
 
+    void throwMethod(jint kind)
+    {
+        objRef->invokeMethod<void>("throwMethod", kind);
+    }
+
     MOCK_METHOD(void, nativeVoidCallNoArgs, ());
     MOCK_METHOD(void, nativeVoidCall, ());
 
     static void registerNativeMethods()
     {
         auto cls = JVM::getEnv().getClass("lv/gusc/jni/tests/NativeClass");
-        cls.registerNativeMethod("nativeVoidMethodNoArgs", &NativeClassMock::nativeVoidMethodNoArgsJni);
-        cls.registerNativeMethod("nativeVoidMethod", &NativeClassMock::nativeVoidMethodJni);
-        cls.registerNativeMethod("nativeBooleanMethod", &NativeClassMock::nativeBooleanMethodJni);
-        cls.registerNativeMethod("nativeByteMethod", &NativeClassMock::nativeByteMethodJni);
-        cls.registerNativeMethod("nativeCharMethod", &NativeClassMock::nativeCharMethodJni);
-        cls.registerNativeMethod("nativeShortMethod", &NativeClassMock::nativeShortMethodJni);
-        cls.registerNativeMethod("nativeIntMethod", &NativeClassMock::nativeIntMethodJni);
-        cls.registerNativeMethod("nativeLongMethod", &NativeClassMock::nativeLongMethodJni);
-        cls.registerNativeMethod("nativeFloatMethod", &NativeClassMock::nativeFloatMethodJni);
-        cls.registerNativeMethod("nativeDoubleMethod", &NativeClassMock::nativeDoubleMethodJni);
-        cls.registerNativeMethod("nativeStringMethod", &NativeClassMock::nativeStringMethodJni);
-        cls.registerNativeMethod("nativeBooleanArrayMethod", &NativeClassMock::nativeBooleanArrayMethodJni);
-        cls.registerNativeMethod("nativeByteArrayMethod", &NativeClassMock::nativeByteArrayMethodJni);
-        cls.registerNativeMethod("nativeCharArrayMethod", &NativeClassMock::nativeCharArrayMethodJni);
-        cls.registerNativeMethod("nativeShortArrayMethod", &NativeClassMock::nativeShortArrayMethodJni);
-        cls.registerNativeMethod("nativeIntArrayMethod", &NativeClassMock::nativeIntArrayMethodJni);
-        cls.registerNativeMethod("nativeLongArrayMethod", &NativeClassMock::nativeLongArrayMethodJni);
-        cls.registerNativeMethod("nativeFloatArrayMethod", &NativeClassMock::nativeFloatArrayMethodJni);
-        cls.registerNativeMethod("nativeDoubleArrayMethod", &NativeClassMock::nativeDoubleArrayMethodJni);
+        JNativePeer<NativeClassMock>::bind(cls, "nativePtr");
+        JExceptionRegistry::registerNativeException<NativeCustomError>("lv/gusc/jni/tests/CustomException");
+        cls.registerNativeMethods({
+            JNativeMethod<&NativeClassMock::nativeVoidMethodNoArgs>::describe("nativeVoidMethodNoArgs"),
+            JNativeMethod<&NativeClassMock::nativeVoidMethod>::describe("nativeVoidMethod"),
+            JNativeMethod<&NativeClassMock::nativeBooleanMethod>::describe("nativeBooleanMethod"),
+            JNativeMethod<&NativeClassMock::nativeByteMethod>::describe("nativeByteMethod"),
+            JNativeMethod<&NativeClassMock::nativeCharMethod>::describe("nativeCharMethod"),
+            JNativeMethod<&NativeClassMock::nativeShortMethod>::describe("nativeShortMethod"),
+            JNativeMethod<&NativeClassMock::nativeIntMethod>::describe("nativeIntMethod"),
+            JNativeMethod<&NativeClassMock::nativeLongMethod>::describe("nativeLongMethod"),
+            JNativeMethod<&NativeClassMock::nativeFloatMethod>::describe("nativeFloatMethod"),
+            JNativeMethod<&NativeClassMock::nativeDoubleMethod>::describe("nativeDoubleMethod"),
+            JNativeMethod<&NativeClassMock::nativeStringMethod>::describe("nativeStringMethod"),
+            JNativeMethod<&NativeClassMock::nativeBooleanArrayMethod>::describe("nativeBooleanArrayMethod"),
+            JNativeMethod<&NativeClassMock::nativeByteArrayMethod>::describe("nativeByteArrayMethod"),
+            JNativeMethod<&NativeClassMock::nativeCharArrayMethod>::describe("nativeCharArrayMethod"),
+            JNativeMethod<&NativeClassMock::nativeShortArrayMethod>::describe("nativeShortArrayMethod"),
+            JNativeMethod<&NativeClassMock::nativeIntArrayMethod>::describe("nativeIntArrayMethod"),
+            JNativeMethod<&NativeClassMock::nativeLongArrayMethod>::describe("nativeLongArrayMethod"),
+            JNativeMethod<&NativeClassMock::nativeFloatArrayMethod>::describe("nativeFloatArrayMethod"),
+            JNativeMethod<&NativeClassMock::nativeDoubleArrayMethod>::describe("nativeDoubleArrayMethod"),
+            JNativeMethod<&NativeClassMock::nativeThrowMethod>::describe("nativeThrowMethod")
+        });
     }
 private:
+    jlong handle;
     JGlobalRef objRef;
 
     void nativeVoidMethodNoArgs()
@@ -289,100 +293,23 @@ private:
         return val;
     }
 
-    static void nativeVoidMethodNoArgsJni(JNIEnv*, jobject thiz)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        ptr->nativeVoidMethodNoArgs();
-    }
-    static void nativeVoidMethodJni(JNIEnv*, jobject thiz, jboolean newA, jbyte newB, jchar newC, jshort newD, jint newE, jlong newF, jfloat newG, jdouble newH, jstring newI)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        ptr->nativeVoidMethod(newA, newB, newC, newD, newE, newF, newG, newH, newI);
-    }
-    static jboolean nativeBooleanMethodJni(JNIEnv*, jobject thiz, jboolean val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeBooleanMethod(val);
-    }
-    static jbyte nativeByteMethodJni(JNIEnv*, jobject thiz, jbyte val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeByteMethod(val);
-    }
-    static jchar nativeCharMethodJni(JNIEnv*, jobject thiz, jchar val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeCharMethod(val);
-    }
-    static jshort nativeShortMethodJni(JNIEnv*, jobject thiz, jshort val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeShortMethod(val);
-    }
-    static jint nativeIntMethodJni(JNIEnv*, jobject thiz, jint val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeIntMethod(val);
-    }
-    static jlong nativeLongMethodJni(JNIEnv*, jobject thiz, jlong val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeLongMethod(val);
-    }
-    static jfloat nativeFloatMethodJni(JNIEnv*, jobject thiz, jfloat val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeFloatMethod(val);
-    }
-    static jdouble nativeDoubleMethodJni(JNIEnv*, jobject thiz, jdouble val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeDoubleMethod(val);
-    }
-    static jstring nativeStringMethodJni(JNIEnv*, jobject thiz, jstring val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeStringMethod(val);
-    }
-    static jbooleanArray nativeBooleanArrayMethodJni(JNIEnv*, jobject thiz, jbooleanArray val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeBooleanArrayMethod(val);
-    }
-    static jbyteArray nativeByteArrayMethodJni(JNIEnv*, jobject thiz, jbyteArray val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeByteArrayMethod(val);
-    }
-    static jcharArray nativeCharArrayMethodJni(JNIEnv*, jobject thiz, jcharArray val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeCharArrayMethod(val);
-    }
-    static jshortArray nativeShortArrayMethodJni(JNIEnv*, jobject thiz, jshortArray val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeShortArrayMethod(val);
-    }
-    static jintArray nativeIntArrayMethodJni(JNIEnv*, jobject thiz, jintArray val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeIntArrayMethod(val);
-    }
-    static jlongArray nativeLongArrayMethodJni(JNIEnv*, jobject thiz, jlongArray val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeLongArrayMethod(val);
-    }
-    static jfloatArray nativeFloatArrayMethodJni(JNIEnv*, jobject thiz, jfloatArray val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeFloatArrayMethod(val);
-    }
-    static jdoubleArray nativeDoubleArrayMethodJni(JNIEnv*, jobject thiz, jdoubleArray val)
-    {
-        auto ptr = toPtr<NativeClassMock>(JObject(thiz).getField<jlong>("nativePtr"));
-        return ptr->nativeDoubleArrayMethod(val);
+    void nativeThrowMethod(jint kind)
+    {
+        switch (kind)
+        {
+            case 0:
+                throw std::invalid_argument("invalid argument");
+            case 1:
+                throw std::runtime_error("runtime error");
+            case 2:
+                // Java exception thrown by a nested call goes back to Java as it is
+                JVM::getEnv().getClass("lv/gusc/jni/tests/ExceptionClass").invokeMethod<void>("throwIllegalState", JString::createFrom("nested"));
+                break;
+            case 3:
+                throw NativeCustomError();
+            default:
+                throw 42;
+        }
     }
 };
 
@@ -89,4 +89,55 @@ TEST_F(NativeClassTest, InstanceClass)
     auto instance2 = mock.instancePassthrough(instance);
     auto res2 = instance.invokeMethod<jboolean>("getBoolean");
     EXPECT_FALSE(res2);
-}
\ No newline at end of file
+}
+TEST_F(NativeClassTest, Exceptions)
+{
+    // C++ exceptions thrown by native methods are thrown in Java and translated back to C++
+    try
+    {
+        mock.throwMethod(0);
+        FAIL();
+    }
+    catch (const JIllegalArgumentException& e)
+    {
+        EXPECT_EQ(e.getMessage(), std::string{"invalid argument"});
+    }
+    try
+    {
+        mock.throwMethod(1);
+        FAIL();
+    }
+    catch (const JRuntimeException& e)
+    {
+        EXPECT_EQ(e.getClassName(), std::string{"java.lang.RuntimeException"});
+        EXPECT_EQ(e.getMessage(), std::string{"runtime error"});
+    }
+    try
+    {
+        mock.throwMethod(2);
+        FAIL();
+    }
+    catch (const JIllegalStateException& e)
+    {
+        EXPECT_EQ(e.getMessage(), std::string{"nested"});
+    }
+    try
+    {
+        mock.throwMethod(3);
+        FAIL();
+    }
+    catch (const JIllegalStateException& e)
+    {
+        EXPECT_EQ(e.getClassName(), std::string{"lv.gusc.jni.tests.CustomException"});
+        EXPECT_EQ(e.getMessage(), std::string{"custom error"});
+    }
+    try
+    {
+        mock.throwMethod(4);
+        FAIL();
+    }
+    catch (const JRuntimeException& e)
+    {
+        EXPECT_EQ(e.getMessage(), std::string{"Unknown native exception"});
+    }
+}
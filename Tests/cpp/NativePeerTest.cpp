@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+#include "NativeClassMock.hpp"
+
+namespace
+{
+struct Peer
+{
+    int value { 0 };
+
+    jint getValue() const
+    {
+        return value;
+    }
+    void setValue(jint newValue)
+    {
+        value = newValue;
+    }
+    JString getName(const JString& prefix)
+    {
+        return JString::createFrom(static_cast<std::string>(prefix) + std::to_string(value));
+    }
+};
+}
+
+TEST(NativePeerTest, HandleTable)
+{
+    JHandleTable<Peer> table;
+    Peer a { 1 };
+    Peer b { 2 };
+    const auto handleA = table.insert(&a);
+    const auto handleB = table.insert(&b);
+    EXPECT_NE(handleA, JHandleTable<Peer>::invalidHandle);
+    EXPECT_NE(handleA, handleB);
+    EXPECT_EQ(table.get(handleA), &a);
+    EXPECT_EQ(table.get(handleB), &b);
+    EXPECT_EQ(table.get(JHandleTable<Peer>::invalidHandle), nullptr);
+    EXPECT_THROW(table.insert(nullptr), std::invalid_argument);
+
+    EXPECT_EQ(table.erase(handleA), &a);
+    EXPECT_EQ(table.get(handleA), nullptr);
+    EXPECT_FALSE(table.contains(handleA));
+    EXPECT_EQ(table.erase(handleA), nullptr);
+
+    // Slot is reused with a new generation, the old handle stays stale
+    Peer c { 3 };
+    const auto handleC = table.insert(&c);
+    EXPECT_NE(handleC, handleA);
+    EXPECT_EQ(table.get(handleC), &c);
+    EXPECT_EQ(table.get(handleA), nullptr);
+    EXPECT_EQ(table.get(handleB), &b);
+}
+
+TEST(NativePeerTest, HandleTableGrowth)
+{
+    JHandleTable<Peer> table;
+    std::vector<Peer> peers(1000);
+    std::vector<jlong> handles;
+    for (auto& peer : peers)
+    {
+        handles.push_back(table.insert(&peer));
+    }
+    for (std::size_t i = 0; i < peers.size(); ++i)
+    {
+        EXPECT_EQ(table.get(handles[i]), &peers[i]);
+    }
+}
+
+TEST(NativePeerTest, NativePeer)
+{
+    auto env = JVM::getEnv();
+    NativeClassMock mock;
+    EXPECT_EQ(JNativePeer<NativeClassMock>::get(env, mock.getObject()), &mock);
+    EXPECT_EQ(&JNativePeer<NativeClassMock>::getChecked(env, mock.getObject()), &mock);
+    EXPECT_EQ(JNativePeer<NativeClassMock>::detach(env, mock.getObject()), &mock);
+    EXPECT_EQ(JNativePeer<NativeClassMock>::get(env, mock.getObject()), nullptr);
+    EXPECT_EQ(JNativePeer<NativeClassMock>::get(mock.getHandle()), nullptr);
+    EXPECT_THROW(JNativePeer<NativeClassMock>::getChecked(env, mock.getObject()), std::runtime_error);
+}
+
+TEST(NativePeerTest, NativeMethodSignature)
+{
+    EXPECT_STREQ(JNativeMethod<&Peer::getValue>::getSignature(), "()I");
+    EXPECT_STREQ(JNativeMethod<&Peer::setValue>::getSignature(), "(I)V");
+    EXPECT_STREQ(JNativeMethod<&Peer::getName>::getSignature(), "(Ljava/lang/String;)Ljava/lang/String;");
+    const auto method = JNativeMethod<&Peer::setValue>::describe("nativeSetValue");
+    EXPECT_STREQ(method.name, "nativeSetValue");
+    EXPECT_STREQ(method.signature, "(I)V");
+    EXPECT_NE(method.fnPtr, nullptr);
+}
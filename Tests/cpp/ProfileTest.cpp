@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+class ProfileTest : public Test
+{
+public:
+    std::string getProfilePath()
+    {
+        auto system = JVM::getEnv().getClass("java/lang/System");
+        auto tmpDir = system.invokeMethod<JString>("getProperty", JString::createFrom("java.io.tmpdir"));
+        return static_cast<std::string>(tmpDir) + "/jni_profile_test.txt";
+    }
+};
+
+TEST_F(ProfileTest, SaveLoad)
+{
+    std::vector<JProfileEntry> entries {
+        { JMemberKind::Class, "lv/gusc/jni/tests/StaticClass", "", "", 1, std::chrono::nanoseconds { 10 } },
+        { JMemberKind::StaticMethod, "lv/gusc/jni/tests/StaticClass", "getInt", "()I", 5, std::chrono::nanoseconds { 20 } },
+        { JMemberKind::Field, "lv/gusc/jni/tests/TestClass", "s", "Ljava/lang/String;", 2, std::chrono::nanoseconds { 30 } },
+        { JMemberKind::Method, "lv/gusc/jni/tests/TestClass", "removedMethod", "()V", 1, std::chrono::nanoseconds { 40 } }
+    };
+    const auto path = getProfilePath();
+    JProfile::save(path, entries);
+    const auto loaded = JProfile::load(path);
+    ASSERT_EQ(loaded.size(), entries.size());
+    EXPECT_EQ(loaded[1].kind, JMemberKind::StaticMethod);
+    EXPECT_EQ(loaded[1].className, "lv/gusc/jni/tests/StaticClass");
+    EXPECT_EQ(loaded[1].name, "getInt");
+    EXPECT_EQ(loaded[1].signature, "()I");
+    EXPECT_EQ(loaded[1].count, 5u);
+    EXPECT_EQ(loaded[1].firstUse.count(), 20);
+    EXPECT_EQ(loaded[0].name, "");
+
+    // Members removed from the Java side are reported, not thrown
+    const auto report = JProfile::preload(loaded);
+    ASSERT_EQ(report.entries.size(), 4u);
+    EXPECT_TRUE(report.entries[0].error.empty());
+    EXPECT_TRUE(report.entries[1].error.empty());
+    EXPECT_TRUE(report.entries[2].error.empty());
+    EXPECT_FALSE(report.entries[3].error.empty());
+    EXPECT_EQ(JProfile::preload(loaded, 2).entries.size(), 2u);
+
+    auto thread = JProfile::preloadAsync(loaded);
+    thread.join();
+    EXPECT_THROW(JProfile::load(path + ".missing"), std::runtime_error);
+}
+
+#if defined(GUSC_JNI_PROFILE)
+TEST_F(ProfileTest, Record)
+{
+    JProfile::clear();
+    JProfile::start();
+    auto cls = JVM::getEnv().getClass("lv/gusc/jni/tests/StaticClass");
+    cls.invokeMethod<jint>("getInt");
+    cls.invokeMethod<jint>("getInt");
+    cls.getField<jint>("intField");
+    JProfile::stop();
+    cls.invokeMethod<jint>("getInt");
+    const auto entries = JProfile::getEntries();
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].kind, JMemberKind::Class);
+    EXPECT_EQ(entries[0].className, "lv/gusc/jni/tests/StaticClass");
+    EXPECT_EQ(entries[1].kind, JMemberKind::StaticMethod);
+    EXPECT_EQ(entries[1].className, "lv/gusc/jni/tests/StaticClass");
+    EXPECT_EQ(entries[1].count, 2u);
+    EXPECT_EQ(entries[2].kind, JMemberKind::StaticField);
+    EXPECT_LE(entries[1].firstUse, entries[2].firstUse);
+}
+#endif
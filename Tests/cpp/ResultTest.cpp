@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+class ResultTest : public Test
+{
+public:
+    JClass instanceClass { JVM::getEnv().getClass("lv/gusc/jni/tests/InstanceClass").createGlobalRef() };
+    JClass staticClass { JVM::getEnv().getClass("lv/gusc/jni/tests/StaticClass").createGlobalRef() };
+    JClass exceptionClass { JVM::getEnv().getClass("lv/gusc/jni/tests/ExceptionClass").createGlobalRef() };
+};
+
+TEST_F(ResultTest, Lookup)
+{
+    auto env = JVM::getEnv();
+    auto cls = env.tryGetClass("lv/gusc/jni/tests/MissingClass");
+    EXPECT_FALSE(cls);
+    EXPECT_EQ(cls.getErrorKind(), JErrorKind::ClassNotFound);
+    EXPECT_EQ(cls.getMessage(), std::string{"Can't find lv/gusc/jni/tests/MissingClass Java class"});
+    EXPECT_FALSE(env->ExceptionCheck());
+    EXPECT_TRUE(env.tryGetClass("lv/gusc/jni/tests/InstanceClass"));
+
+    auto methodId = staticClass.tryGetStaticMethodIdJni(env, "missingMethod", "()V");
+    EXPECT_EQ(methodId.getErrorKind(), JErrorKind::MethodNotFound);
+    EXPECT_FALSE(env->ExceptionCheck());
+    EXPECT_TRUE(staticClass.tryGetStaticMethodIdJni(env, "voidMethodNoArgs", "()V"));
+
+    auto fieldId = instanceClass.tryGetFieldIdJni(env, "missingField", "I");
+    EXPECT_EQ(fieldId.getErrorKind(), JErrorKind::FieldNotFound);
+    EXPECT_EQ(fieldId.getMessage(), std::string{"Can't find field missingField with signature I"});
+    EXPECT_THROW(fieldId.throwIfError(), std::runtime_error);
+}
+
+TEST_F(ResultTest, Invoke)
+{
+    auto res = staticClass.tryInvokeMethod<jint>("getInt");
+    ASSERT_TRUE(res);
+    EXPECT_EQ(res.getValue(), staticClass.getField<jint>("intField"));
+    EXPECT_TRUE(staticClass.tryInvokeMethod<void>("voidMethodNoArgs"));
+
+    auto missing = staticClass.tryInvokeMethod<jint>("missingMethod");
+    EXPECT_EQ(missing.getErrorKind(), JErrorKind::MethodNotFound);
+    EXPECT_EQ(missing.getValueOr(-1), -1);
+
+    auto thrown = exceptionClass.tryInvokeMethod<void>("throwIllegalState", JString::createFrom("state"));
+    EXPECT_EQ(thrown.getErrorKind(), JErrorKind::JavaException);
+    ASSERT_NE(thrown.getException(), nullptr);
+    EXPECT_EQ(thrown.getException()->getMessage(), std::string{"state"});
+    EXPECT_EQ(thrown.getException()->getClassName(), std::string{"java.lang.IllegalStateException"});
+    EXPECT_FALSE(JVM::getEnv()->ExceptionCheck());
+    EXPECT_THROW(thrown.throwIfError(), JException);
+
+    auto obj = instanceClass.tryCreateObject();
+    ASSERT_TRUE(obj);
+    EXPECT_EQ(obj.getValue().tryInvokeMethod<jint>("getInt").getValueOr(0), obj.getValue().getField<jint>("intField"));
+    EXPECT_EQ(obj.getValue().tryInvokeMethod<void>("missingMethod").getErrorKind(), JErrorKind::MethodNotFound);
+    EXPECT_EQ(instanceClass.tryCreateObject(1.0).getErrorKind(), JErrorKind::MethodNotFound);
+}
+
+TEST_F(ResultTest, Field)
+{
+    auto obj = instanceClass.createObject();
+    EXPECT_TRUE(obj.trySetField<jint>("intField", 42));
+    EXPECT_EQ(obj.tryGetField<jint>("intField").getValue(), 42);
+    EXPECT_EQ(obj.tryGetField<jint>("missingField").getErrorKind(), JErrorKind::FieldNotFound);
+    EXPECT_EQ(obj.trySetField<jlong>("intField", 1).getErrorKind(), JErrorKind::FieldNotFound);
+
+    const auto value = staticClass.getField<jdouble>("doubleField");
+    EXPECT_TRUE(staticClass.trySetField<jdouble>("doubleField", value + 1.0));
+    EXPECT_EQ(staticClass.tryGetField<jdouble>("doubleField").getValue(), value + 1.0);
+    staticClass.setField<jdouble>("doubleField", value);
+    EXPECT_EQ(staticClass.tryGetField<jint>("missingField").getErrorKind(), JErrorKind::FieldNotFound);
+}
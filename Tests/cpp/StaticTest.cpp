@@ -251,4 +251,30 @@ TEST_F(StaticTest, Fields)
     EXPECT_EQ(static_cast<std::string>(test.invokeMethod<JString>("getString")), std::string{"ASDF"});
     auto testInstance = testClass.createObjectS().createGlobalRefS();
     cls.setField("testClassField", testInstance);
-}
\ No newline at end of file
+}
+TEST_F(StaticTest, Constants)
+{
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/StaticClass") };
+    JStaticConstant<jint> bufferSize { cls, "BUFFER_SIZE" };
+    EXPECT_TRUE(bufferSize.isLoaded());
+    EXPECT_EQ(bufferSize.get(), 512);
+    EXPECT_FALSE(JStaticConstant<jint>().isLoaded());
+    EXPECT_STREQ(JStaticConstant<std::string>::getSignature(), "Ljava/lang/String;");
+
+    struct Constants
+    {
+        jint bufferSize;
+        jboolean debug;
+        std::string version;
+    };
+    const auto constants = loadConstants(
+        cls,
+        mapConstant(&Constants::bufferSize, "BUFFER_SIZE"),
+        mapConstant(&Constants::debug, "DEBUG"),
+        mapConstant(&Constants::version, "VERSION")
+    );
+    EXPECT_EQ(constants.bufferSize, 512);
+    EXPECT_EQ(constants.debug, JNI_TRUE);
+    EXPECT_EQ(constants.version, "1.0");
+    EXPECT_THROW(JStaticConstant<jint>(cls, "MISSING"), std::runtime_error);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Jni/Jni.hpp"
+
+using namespace gusc::Jni;
+using namespace ::testing;
+
+class ThreadPoolTest : public Test
+{
+public:
+    JClass cls { JVM::getEnv().getClass("lv/gusc/jni/tests/StaticClass").createGlobalRef() };
+};
+
+TEST_F(ThreadPoolTest, Submit)
+{
+    JThreadPool pool { 4, "JniTestWorker" };
+    EXPECT_EQ(pool.size(), 4u);
+    const auto expected = cls.getField<jint>("intField");
+    std::vector<std::future<jint>> results;
+    for (int i = 0; i < 100; ++i)
+    {
+        results.push_back(pool.submit([this](JEnv& env) {
+            // Worker env is installed for the whole thread
+            EXPECT_EQ(JVM::getScopedEnv(), static_cast<JNIEnv*>(env));
+            return cls.invokeMethod<jint>("getInt");
+        }));
+    }
+    for (auto& result : results)
+    {
+        EXPECT_EQ(result.get(), expected);
+    }
+    auto name = pool.submit([](JEnv&) {
+        auto thread = JVM::getEnv().getClass("java/lang/Thread").invokeMethodSign<JObject>("currentThread", "()Ljava/lang/Thread;");
+        return static_cast<std::string>(thread.invokeMethod<JString>("getName"));
+    });
+    EXPECT_EQ(name.get().rfind("JniTestWorker-", 0), 0u);
+}
+
+TEST_F(ThreadPoolTest, Post)
+{
+    std::atomic<int> count { 0 };
+    {
+        JThreadPool pool { 2 };
+        for (int i = 0; i < 1000; ++i)
+        {
+            pool.post([&count](JEnv&) {
+                ++count;
+            });
+        }
+        pool.wait();
+        EXPECT_EQ(count.load(), 1000);
+        // Tasks queued from a worker run on the same pool
+        pool.post([&pool, &count](JEnv&) {
+            pool.post([&count](JEnv&) {
+                ++count;
+            });
+        });
+        pool.wait();
+        EXPECT_EQ(count.load(), 1001);
+        for (int i = 0; i < 100; ++i)
+        {
+            pool.post([&count](JEnv&) {
+                ++count;
+            });
+        }
+    }
+    // Destructor runs the remaining tasks
+    EXPECT_EQ(count.load(), 1101);
+}
+
+TEST_F(ThreadPoolTest, Exceptions)
+{
+    JThreadPool pool { 2 };
+    auto exceptionCls = JVM::getEnv().getClass("lv/gusc/jni/tests/ExceptionClass").createGlobalRef();
+    auto javaError = pool.submit([&exceptionCls](JEnv& env) {
+        env->CallStaticVoidMethod(exceptionCls, exceptionCls.getStaticMethodIdJni(env, "throwRuntime", "(Ljava/lang/String;)V"), nullptr);
+    });
+    EXPECT_THROW(javaError.get(), JException);
+    auto nativeError = pool.submit([](JEnv&) -> jint {
+        throw std::logic_error("error");
+    });
+    EXPECT_THROW(nativeError.get(), std::logic_error);
+    // A task can't wait for its own pool
+    auto waitError = pool.submit([&pool](JEnv&) {
+        pool.wait();
+    });
+    EXPECT_THROW(waitError.get(), std::logic_error);
+    // Workers keep running after failed tasks
+    EXPECT_EQ(pool.submit([](JEnv&) { return 1; }).get(), 1);
+}
+
+TEST_F(ThreadPoolTest, InvokeAsync)
+{
+    JThreadPool pool { 2 };
+    auto boxedCls = JVM::getEnv().getClass("lv/gusc/jni/tests/BoxedClass");
+    // Local references are promoted to global references for the hop
+    auto increment = boxedCls.invokeMethodAsync<JInteger>(pool, "increment", JInteger::valueOf(41));
+    auto result = increment.get();
+    EXPECT_EQ(JVM::getEnv()->GetObjectRefType(result), JNIGlobalRefType);
+    EXPECT_EQ(result.getValue(), 42);
+
+    auto testObj = JVM::getEnv().getClass("lv/gusc/jni/tests/TestClass").createObject();
+    auto str = testObj.invokeMethodAsync<JString>("getString");
+    EXPECT_EQ(static_cast<std::string>(str.get()), "ASDF");
+    auto call = testObj.invokeMethodAsync<void>(pool, "callMe");
+    EXPECT_NO_THROW(call.get());
+    EXPECT_THROW(testObj.invokeMethodAsync<void>(pool, "missingMethod").get(), std::runtime_error);
+
+    // Unattached threads are rejected instead of being attached for the call
+    auto globalObj = testObj.createGlobalRef();
+    std::thread unattached([&]() {
+        EXPECT_THROW(globalObj.invokeMethodAsync<void>(pool, "callMe"), std::runtime_error);
+        EXPECT_EQ(JVM::getAttachedEnv(), nullptr);
+    });
+    unattached.join();
+}
@@ -0,0 +1,20 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+public class BaseClass {
+
+    @Keep
+    public BaseClass() {
+    }
+
+    @Keep
+    public int getValue() {
+        return 1;
+    }
+
+    @Keep
+    public String getName() {
+        return "base";
+    }
+}
@@ -0,0 +1,77 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+public class BenchmarkClass {
+
+    @Keep
+    public long longField = 1;
+
+    @Keep
+    public static final int BLOCK_SIZE = 64;
+
+    @Keep
+    int args0() {
+        return 0;
+    }
+
+    @Keep
+    int args1(int a0) {
+        return 1;
+    }
+
+    @Keep
+    int args2(int a0, float a1) {
+        return 2;
+    }
+
+    @Keep
+    int args3(int a0, float a1, int a2) {
+        return 3;
+    }
+
+    @Keep
+    int args4(int a0, float a1, int a2, float a3) {
+        return 4;
+    }
+
+    @Keep
+    int args5(int a0, float a1, int a2, float a3, int a4) {
+        return 5;
+    }
+
+    @Keep
+    int args6(int a0, float a1, int a2, float a3, int a4, float a5) {
+        return 6;
+    }
+
+    @Keep
+    int args7(int a0, float a1, int a2, float a3, int a4, float a5, int a6) {
+        return 7;
+    }
+
+    @Keep
+    int args8(int a0, float a1, int a2, float a3, int a4, float a5, int a6, float a7) {
+        return 8;
+    }
+
+    @Keep
+    int args9(int a0, float a1, int a2, float a3, int a4, float a5, int a6, float a7, int a8) {
+        return 9;
+    }
+
+    @Keep
+    int args10(int a0, float a1, int a2, float a3, int a4, float a5, int a6, float a7, int a8, float a9) {
+        return 10;
+    }
+
+    @Keep
+    int args11(int a0, float a1, int a2, float a3, int a4, float a5, int a6, float a7, int a8, float a9, int a10) {
+        return 11;
+    }
+
+    @Keep
+    int args12(int a0, float a1, int a2, float a3, int a4, float a5, int a6, float a7, int a8, float a9, int a10, float a11) {
+        return 12;
+    }
+}
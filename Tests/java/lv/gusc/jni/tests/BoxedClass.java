@@ -0,0 +1,26 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+public class BoxedClass {
+
+    @Keep
+    static Integer increment(Integer value) {
+        return value + 1;
+    }
+
+    @Keep
+    static Double half(Double value) {
+        return value / 2.0;
+    }
+
+    @Keep
+    static boolean isTrue(Boolean value) {
+        return value;
+    }
+
+    @Keep
+    static Long getNull() {
+        return null;
+    }
+}
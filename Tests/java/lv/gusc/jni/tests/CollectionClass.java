@@ -0,0 +1,38 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+public class CollectionClass {
+
+    @Keep
+    static List<Float> createFloatList(int count) {
+        List<Float> res = new ArrayList<>();
+        for (int i = 0; i < count; ++i) {
+            res.add(i * 0.5f);
+        }
+        return res;
+    }
+
+    @Keep
+    static List<String> createStringList() {
+        List<String> res = new ArrayList<>();
+        res.add("one");
+        res.add("two");
+        res.add("three");
+        return res;
+    }
+
+    @Keep
+    static Map<String, Integer> createMap(int count) {
+        Map<String, Integer> res = new HashMap<>();
+        for (int i = 0; i < count; ++i) {
+            res.put("key" + i, i);
+        }
+        return res;
+    }
+}
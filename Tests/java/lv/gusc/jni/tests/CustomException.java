@@ -0,0 +1,11 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+public class CustomException extends IllegalStateException {
+
+    @Keep
+    public CustomException(String message) {
+        super(message);
+    }
+}
@@ -0,0 +1,22 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+public class DerivedClass extends BaseClass {
+
+    @Keep
+    public DerivedClass() {
+    }
+
+    @Keep
+    @Override
+    public int getValue() {
+        return 2;
+    }
+
+    @Keep
+    @Override
+    public String getName() {
+        return "derived";
+    }
+}
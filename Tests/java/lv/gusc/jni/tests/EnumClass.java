@@ -0,0 +1,21 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+public class EnumClass {
+
+    @Keep
+    static int getOrdinal(FilterType type) {
+        return type.ordinal();
+    }
+
+    @Keep
+    static FilterType getHighPass() {
+        return FilterType.HIGH_PASS;
+    }
+
+    @Keep
+    static FilterType next(FilterType type) {
+        return FilterType.values()[(type.ordinal() + 1) % FilterType.values().length];
+    }
+}
@@ -0,0 +1,43 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+public class EventClass {
+
+    private int levelCount = 0;
+    private int stateCount = 0;
+    private float lastLevel = 0.0f;
+    private int lastState = 0;
+
+    @Keep
+    void onLevel(int channel, float level) {
+        ++levelCount;
+        lastLevel = level;
+    }
+
+    @Keep
+    void onState(int state) {
+        ++stateCount;
+        lastState = state;
+    }
+
+    @Keep
+    int getLevelCount() {
+        return levelCount;
+    }
+
+    @Keep
+    int getStateCount() {
+        return stateCount;
+    }
+
+    @Keep
+    float getLastLevel() {
+        return lastLevel;
+    }
+
+    @Keep
+    int getLastState() {
+        return lastState;
+    }
+}
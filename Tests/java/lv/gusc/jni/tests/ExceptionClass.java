@@ -0,0 +1,40 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+public class ExceptionClass {
+
+    @Keep
+    ExceptionClass() {
+    }
+
+    @Keep
+    ExceptionClass(int code) {
+        throw new IllegalArgumentException("code " + code);
+    }
+
+    @Keep
+    static void throwRuntime(String message) {
+        throw new RuntimeException(message);
+    }
+
+    @Keep
+    static void throwIllegalArgument(String message) {
+        throw new IllegalArgumentException(message);
+    }
+
+    @Keep
+    static void throwIllegalState(String message) {
+        throw new IllegalStateException(message);
+    }
+
+    @Keep
+    static void throwCustom(String message) {
+        throw new CustomException(message);
+    }
+
+    @Keep
+    static void throwChecked(String message) throws Exception {
+        throw new Exception(message);
+    }
+}
@@ -0,0 +1,10 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+@Keep
+public enum FilterType {
+    LOW_PASS,
+    HIGH_PASS,
+    BAND_PASS
+}
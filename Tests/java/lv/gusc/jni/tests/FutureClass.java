@@ -0,0 +1,42 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.TimeUnit;
+
+public class FutureClass {
+
+    private static final ScheduledExecutorService scheduler = Executors.newSingleThreadScheduledExecutor();
+
+    @Keep
+    static CompletableFuture<Integer> completed(int value) {
+        return CompletableFuture.completedFuture(value);
+    }
+
+    @Keep
+    static CompletableFuture<String> delayed(String value, int delayMs) {
+        CompletableFuture<String> future = new CompletableFuture<>();
+        scheduler.schedule(() -> future.complete(value), delayMs, TimeUnit.MILLISECONDS);
+        return future;
+    }
+
+    @Keep
+    static CompletableFuture<Integer> failed(String message) {
+        CompletableFuture<Integer> future = new CompletableFuture<>();
+        future.completeExceptionally(new IllegalStateException(message));
+        return future;
+    }
+
+    @Keep
+    static CompletableFuture<Integer> failedDelayed(String message, int delayMs) {
+        // Stages that throw complete their dependents with a CompletionException
+        CompletableFuture<Integer> future = new CompletableFuture<>();
+        scheduler.schedule(() -> future.complete(0), delayMs, TimeUnit.MILLISECONDS);
+        return future.thenApply(value -> {
+            throw new IllegalStateException(message);
+        });
+    }
+}
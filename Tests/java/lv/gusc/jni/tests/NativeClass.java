@@ -138,6 +138,12 @@ public class NativeClass {
         nativeVoidMethod(a, b, c, d, e, f, g, h , i);
     }
 
+    @Keep
+    void throwMethod(int kind)
+    {
+        nativeThrowMethod(kind);
+    }
+
     native void nativeVoidMethodNoArgs();
     native void nativeVoidMethod(boolean a, byte b, char c, short d, int e, long f, float g, double h, String i);
     native boolean nativeBooleanMethod(boolean val);
@@ -157,5 +163,6 @@ public class NativeClass {
     native long[] nativeLongArrayMethod(long[] val);
     native float[] nativeFloatArrayMethod(float[] val);
     native double[] nativeDoubleArrayMethod(double[] val);
+    native void nativeThrowMethod(int kind);
 
 }
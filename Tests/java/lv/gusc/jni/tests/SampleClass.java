@@ -0,0 +1,46 @@
+package lv.gusc.jni.tests;
+
+import androidx.annotation.Keep;
+
+import java.util.ArrayList;
+import java.util.List;
+
+public class SampleClass {
+
+    @Keep
+    public long t;
+
+    @Keep
+    public float v;
+
+    @Keep
+    SampleClass(long t, float v) {
+        this.t = t;
+        this.v = v;
+    }
+
+    @Keep
+    static SampleClass[] createArray(int count) {
+        SampleClass[] res = new SampleClass[count];
+        for (int i = 0; i < count; ++i) {
+            res[i] = new SampleClass(i, i * 0.5f);
+        }
+        return res;
+    }
+
+    @Keep
+    static List<SampleClass> createList(int count) {
+        List<SampleClass> res = new ArrayList<>();
+        for (int i = 0; i < count; ++i) {
+            res.add(new SampleClass(i, i * 0.5f));
+        }
+        return res;
+    }
+
+    @Keep
+    static List<Object> createMixedList(int count) {
+        List<Object> res = new ArrayList<>(createList(count));
+        res.add("not a sample");
+        return res;
+    }
+}
@@ -22,6 +22,12 @@ public class StaticClass {
     public static float[] floatArrayField = {0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f};
     public static double[] doubleArrayField = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
     public static TestClass testClassField = new TestClass();
+    @Keep
+    public static final int BUFFER_SIZE = 512;
+    @Keep
+    public static final boolean DEBUG = true;
+    @Keep
+    public static final String VERSION = "1.0";
 
     @Keep
     static void voidMethodNoArgs() {
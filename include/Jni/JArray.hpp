@@ -15,13 +15,17 @@ class JArray final : public JObject
     {
     public:
         JArrayData(const TJArray& initArray)
-            : jniArray(initArray)
+            : JArrayData(JVM::getEnv(), initArray)
+        {}
+
+        JArrayData(JEnv env, const TJArray& initArray)
+            : jniEnv(env)
+            , jniArray(initArray)
         {
             if (jniArray)
             {
-                auto env = JVM::getEnv();
-                length = env->GetArrayLength(jniArray);
-                dataPtr = getDataPtr(env);
+                length = jniEnv->GetArrayLength(jniArray);
+                dataPtr = getDataPtr(jniEnv);
             }
         }
 
@@ -47,13 +51,13 @@ class JArray final : public JObject
         {
             if (jniArray && dataPtr)
             {
-                auto env = JVM::getEnv();
-                freeDataPtr(env);
+                freeDataPtr(jniEnv);
                 dataPtr = nullptr;
                 length = 0;
             }
         }
     private:
+        JEnv jniEnv;
         TJArray jniArray { nullptr };
         std::size_t length { 0 };
         TJArrayElement* dataPtr { nullptr };
@@ -220,6 +224,11 @@ public:
         return JArrayData { static_cast<TJArray>(jniObject) };
     }
 
+    inline JArrayData getDataJni(JEnv& env) const
+    {
+        return JArrayData { env, static_cast<TJArray>(jniObject) };
+    }
+
     template<typename T=TJArray>
     static inline
     typename std::enable_if_t<std::is_same_v<T, jbyteArray>, JArray<TCpp, T, TJArrayElement>>
@@ -391,6 +400,11 @@ public:
     inline operator std::vector<JObject>()
     {
         auto env = JVM::getEnv();
+        return toVectorJni(env);
+    }
+
+    inline std::vector<JObject> toVectorJni(JEnv& env) const
+    {
         std::vector<JObject> vector;
         for (int i = 0; i < env->GetArrayLength(static_cast<jarray>(jniObject)); ++i)
         {
@@ -408,12 +422,22 @@ public:
     inline JObject operator[](int index)
     {
         auto env = JVM::getEnv();
+        return getElementJni(env, index);
+    }
+
+    inline JObject getElementJni(JEnv& env, int index) const
+    {
         return JObject{ env->GetObjectArrayElement(static_cast<jobjectArray>(jniObject), static_cast<jsize>(index)) };
     }
 
     static inline JObjectArray createFrom(const std::vector<JObject>& vector, const JClass& elementClass)
     {
         auto env = JVM::getEnv();
+        return createFromJni(env, vector, elementClass);
+    }
+
+    static inline JObjectArray createFromJni(JEnv& env, const std::vector<JObject>& vector, const JClass& elementClass)
+    {
         auto arr = env->NewObjectArray(vector.size(), static_cast<jclass>(elementClass), nullptr);
         int i = 0;
         for (const auto& o : vector)
@@ -427,6 +451,11 @@ public:
     static inline JObjectArray createNew(std::size_t initSize, const JObject& initObject, const JClass& elementClass)
     {
         auto env = JVM::getEnv();
+        return createNewJni(env, initSize, initObject, elementClass);
+    }
+
+    static inline JObjectArray createNewJni(JEnv& env, std::size_t initSize, const JObject& initObject, const JClass& elementClass)
+    {
         return env->NewObjectArray(static_cast<jsize>(initSize), static_cast<jclass>(elementClass), static_cast<jobject>(initObject));
     }
 
@@ -447,6 +476,11 @@ public:
     inline operator std::vector<JObjectS<ClassName>>()
     {
         auto env = JVM::getEnv();
+        return toVectorJniS(env);
+    }
+
+    inline std::vector<JObjectS<ClassName>> toVectorJniS(JEnv& env) const
+    {
         std::vector<JObjectS<ClassName>> vector;
         for (int i = 0; i < env->GetArrayLength(static_cast<jarray>(jniObject)); ++i)
         {
@@ -459,13 +493,23 @@ public:
     inline JObjectS<ClassName> operator[](int index)
     {
         auto env = JVM::getEnv();
+        return getElementJniS(env, index);
+    }
+
+    inline JObjectS<ClassName> getElementJniS(JEnv& env, int index) const
+    {
         return JObjectS<ClassName>{ env->GetObjectArrayElement(static_cast<jobjectArray>(jniObject), static_cast<jsize>(index)) };
     }
 
     static inline JObjectArrayS<ClassName> createFromS(const std::vector<JObjectS<ClassName>>& vector)
     {
         auto env = JVM::getEnv();
-        JClassS<ClassName> cls;
+        return createFromJniS(env, vector);
+    }
+
+    static inline JObjectArrayS<ClassName> createFromJniS(JEnv& env, const std::vector<JObjectS<ClassName>>& vector)
+    {
+        const auto& cls = JClassS<ClassName>::getCachedClass();
         auto arr = env->NewObjectArray(vector.size(), static_cast<jclass>(cls), nullptr);
         int i = 0;
         for (const auto& o : vector)
@@ -479,7 +523,12 @@ public:
     static inline JObjectArrayS<ClassName> createNewS(std::size_t initSize, const JObjectS<ClassName>& initObject)
     {
         auto env = JVM::getEnv();
-        JClassS<ClassName> cls;
+        return createNewJniS(env, initSize, initObject);
+    }
+
+    static inline JObjectArrayS<ClassName> createNewJniS(JEnv& env, std::size_t initSize, const JObjectS<ClassName>& initObject)
+    {
+        const auto& cls = JClassS<ClassName>::getCachedClass();
         return env->NewObjectArray(static_cast<jsize>(initSize), static_cast<jclass>(cls), static_cast<jobject>(initObject));
     }
 
@@ -0,0 +1,189 @@
+#ifndef __GUSC_JASYNC_HPP
+#define __GUSC_JASYNC_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JObject.hpp"
+#include "JClass.hpp"
+#include "JThreadPool.hpp"
+#include "private/field.hpp"
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace gusc::Jni
+{
+
+namespace Private
+{
+
+/// @brief Copy of a wrapper that holds a global reference (the copy constructors keep the reference type)
+template<typename T>
+inline T to_global(JEnv& env, const T& value)
+{
+    auto global = env->NewGlobalRef(static_cast<jobject>(value));
+    T res { static_cast<jni_type_t<T>>(global) };
+    env->DeleteGlobalRef(global);
+    return res;
+}
+
+template<typename T>
+inline constexpr bool is_jni_reference_v = std::is_pointer_v<T> && std::is_convertible_v<T, jobject>;
+
+/// @brief Argument of an asynchronous call, references are promoted to global references on the calling thread
+template<typename T, typename = void>
+class async_value final
+{
+public:
+    async_value(JEnv& /*env*/, const T& initValue)
+        : value(initValue)
+    {}
+
+    inline const T& get() const noexcept
+    {
+        return value;
+    }
+
+private:
+    T value;
+};
+
+template<typename T>
+class async_value<T, std::enable_if_t<is_jni_wrapper_v<T>>> final
+{
+public:
+    async_value(JEnv& env, const T& initValue)
+        : value(to_global(env, initValue))
+    {}
+
+    inline const T& get() const noexcept
+    {
+        return value;
+    }
+
+private:
+    T value;
+};
+
+template<typename T>
+class async_value<T, std::enable_if_t<is_jni_reference_v<T>>> final
+{
+public:
+    async_value(JEnv& env, T initValue)
+        : value(static_cast<T>(env->NewGlobalRef(initValue)))
+    {}
+    async_value(const async_value&) = delete;
+    async_value& operator=(const async_value&) = delete;
+    async_value(async_value&& other) noexcept
+    {
+        std::swap(value, other.value);
+    }
+    async_value& operator=(async_value&& other) noexcept
+    {
+        std::swap(value, other.value);
+        return *this;
+    }
+    ~async_value()
+    {
+        if (value)
+        {
+            try
+            {
+                JVM::getEnv()->DeleteGlobalRef(value);
+            }
+            catch (...)
+            {
+            }
+        }
+    }
+
+    inline const T& get() const noexcept
+    {
+        return value;
+    }
+
+private:
+    T value { nullptr };
+};
+
+/// @brief Invoke a method by name on a pool worker, object results are returned as global references
+/// The calling thread must already be attached, it is never attached here (that would attach and detach an
+/// unattached thread on every call)
+template<typename TReturn, typename TReceiver, typename... TArgs>
+inline std::future<TReturn> invoke_async(JThreadPool& pool, const TReceiver& receiver, const std::string& name, const TArgs&... args)
+{
+    auto attachedEnv = JVM::getAttachedEnv();
+    if (!attachedEnv)
+    {
+        throw std::runtime_error("invokeMethodAsync must be called from a thread attached to the JVM");
+    }
+    JEnv env { attachedEnv };
+    return pool.submit([
+        receiver = async_value<TReceiver>(env, receiver),
+        name,
+        args = std::make_tuple(async_value<TArgs>(env, args)...)
+    ](JEnv& workerEnv) -> TReturn {
+        const auto& target = receiver.get();
+        if constexpr (std::is_void_v<TReturn>)
+        {
+            std::apply([&](const auto&... values) {
+                target.template invokeMethod<TReturn>(name, values.get()...);
+            }, args);
+        }
+        else
+        {
+            auto res = std::apply([&](const auto&... values) {
+                return target.template invokeMethod<TReturn>(name, values.get()...);
+            }, args);
+            if constexpr (is_jni_wrapper_v<TReturn>)
+            {
+                return to_global(workerEnv, res);
+            }
+            else if constexpr (is_jni_reference_v<TReturn>)
+            {
+                // Ownership of the global reference goes to the caller
+                auto global = static_cast<TReturn>(workerEnv->NewGlobalRef(res));
+                workerEnv->DeleteLocalRef(res);
+                return global;
+            }
+            else
+            {
+                return res;
+            }
+        }
+    });
+}
+
+}
+
+template<typename TReturn, typename... TArgs>
+inline std::future<TReturn> JObject::invokeMethodAsync(JThreadPool& pool, const std::string& name, const TArgs&... args) const
+{
+    return Private::invoke_async<TReturn>(pool, *this, name, args...);
+}
+
+template<typename TReturn, typename... TArgs>
+inline std::future<TReturn> JObject::invokeMethodAsync(const std::string& name, const TArgs&... args) const
+{
+    return invokeMethodAsync<TReturn>(JThreadPool::getDefault(), name, args...);
+}
+
+template<typename TReturn, typename... TArgs>
+inline std::future<TReturn> JClass::invokeMethodAsync(JThreadPool& pool, const std::string& name, const TArgs&... args) const
+{
+    return Private::invoke_async<TReturn>(pool, *this, name, args...);
+}
+
+template<typename TReturn, typename... TArgs>
+inline std::future<TReturn> JClass::invokeMethodAsync(const std::string& name, const TArgs&... args) const
+{
+    return invokeMethodAsync<TReturn>(JThreadPool::getDefault(), name, args...);
+}
+
+}
+
+#endif // __GUSC_JASYNC_HPP
@@ -0,0 +1,235 @@
+#ifndef __GUSC_JBOXED_HPP
+#define __GUSC_JBOXED_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JObject.hpp"
+#include <stdexcept>
+#include <type_traits>
+
+namespace gusc::Jni
+{
+
+namespace Private
+{
+
+template<typename T>
+struct box_traits;
+
+template<>
+struct box_traits<jboolean>
+{
+    static constexpr const char* className = "java.lang.Boolean";
+    static constexpr const char* classPath = "java/lang/Boolean";
+    static constexpr const char* valueOfSignature = "(Z)Ljava/lang/Boolean;";
+    static constexpr const char* unboxName = "booleanValue";
+    static constexpr const char* unboxSignature = "()Z";
+};
+
+template<>
+struct box_traits<jbyte>
+{
+    static constexpr const char* className = "java.lang.Byte";
+    static constexpr const char* classPath = "java/lang/Byte";
+    static constexpr const char* valueOfSignature = "(B)Ljava/lang/Byte;";
+    static constexpr const char* unboxName = "byteValue";
+    static constexpr const char* unboxSignature = "()B";
+};
+
+template<>
+struct box_traits<jchar>
+{
+    static constexpr const char* className = "java.lang.Character";
+    static constexpr const char* classPath = "java/lang/Character";
+    static constexpr const char* valueOfSignature = "(C)Ljava/lang/Character;";
+    static constexpr const char* unboxName = "charValue";
+    static constexpr const char* unboxSignature = "()C";
+};
+
+template<>
+struct box_traits<jshort>
+{
+    static constexpr const char* className = "java.lang.Short";
+    static constexpr const char* classPath = "java/lang/Short";
+    static constexpr const char* valueOfSignature = "(S)Ljava/lang/Short;";
+    static constexpr const char* unboxName = "shortValue";
+    static constexpr const char* unboxSignature = "()S";
+};
+
+template<>
+struct box_traits<jint>
+{
+    static constexpr const char* className = "java.lang.Integer";
+    static constexpr const char* classPath = "java/lang/Integer";
+    static constexpr const char* valueOfSignature = "(I)Ljava/lang/Integer;";
+    static constexpr const char* unboxName = "intValue";
+    static constexpr const char* unboxSignature = "()I";
+};
+
+template<>
+struct box_traits<jlong>
+{
+    static constexpr const char* className = "java.lang.Long";
+    static constexpr const char* classPath = "java/lang/Long";
+    static constexpr const char* valueOfSignature = "(J)Ljava/lang/Long;";
+    static constexpr const char* unboxName = "longValue";
+    static constexpr const char* unboxSignature = "()J";
+};
+
+template<>
+struct box_traits<jfloat>
+{
+    static constexpr const char* className = "java.lang.Float";
+    static constexpr const char* classPath = "java/lang/Float";
+    static constexpr const char* valueOfSignature = "(F)Ljava/lang/Float;";
+    static constexpr const char* unboxName = "floatValue";
+    static constexpr const char* unboxSignature = "()F";
+};
+
+template<>
+struct box_traits<jdouble>
+{
+    static constexpr const char* className = "java.lang.Double";
+    static constexpr const char* classPath = "java/lang/Double";
+    static constexpr const char* valueOfSignature = "(D)Ljava/lang/Double;";
+    static constexpr const char* unboxName = "doubleValue";
+    static constexpr const char* unboxSignature = "()D";
+};
+
+/// @brief Call a no-argument method that returns a primitive T
+template<typename T>
+inline T call_primitive_method(JNIEnv* env, jobject obj, jmethodID methodId) noexcept
+{
+    if constexpr (std::is_same_v<T, jboolean>)
+    {
+        return env->CallBooleanMethod(obj, methodId);
+    }
+    else if constexpr (std::is_same_v<T, jchar>)
+    {
+        return env->CallCharMethod(obj, methodId);
+    }
+    else if constexpr (std::is_same_v<T, jbyte>)
+    {
+        return env->CallByteMethod(obj, methodId);
+    }
+    else if constexpr (std::is_same_v<T, jshort>)
+    {
+        return env->CallShortMethod(obj, methodId);
+    }
+    else if constexpr (std::is_same_v<T, jint>)
+    {
+        return env->CallIntMethod(obj, methodId);
+    }
+    else if constexpr (std::is_same_v<T, jlong>)
+    {
+        return env->CallLongMethod(obj, methodId);
+    }
+    else if constexpr (std::is_same_v<T, jfloat>)
+    {
+        return env->CallFloatMethod(obj, methodId);
+    }
+    else
+    {
+        static_assert(std::is_same_v<T, jdouble>, "Unsupported primitive type");
+        return env->CallDoubleMethod(obj, methodId);
+    }
+}
+
+/// @brief Boxed class, valueOf and unboxing method IDs, resolved once and kept for the lifetime of the process
+template<typename T>
+struct BoxInfo
+{
+    jclass cls { nullptr };
+    jmethodID valueOf { nullptr };
+    jmethodID unbox { nullptr };
+
+    static const BoxInfo& get(JNIEnv* env)
+    {
+        static const BoxInfo info { env };
+        return info;
+    }
+
+private:
+    BoxInfo(JNIEnv* env)
+    {
+        auto localClass = env->FindClass(box_traits<T>::classPath);
+        cls = static_cast<jclass>(env->NewGlobalRef(localClass));
+        env->DeleteLocalRef(localClass);
+        valueOf = env->GetStaticMethodID(cls, "valueOf", box_traits<T>::valueOfSignature);
+        unbox = env->GetMethodID(cls, box_traits<T>::unboxName, box_traits<T>::unboxSignature);
+    }
+};
+
+}
+
+/// @brief Wrapper for boxed primitive types (java.lang.Integer etc.)
+/// Boxing goes through valueOf, so the JVM's caches of small values are used, the class and the method IDs
+/// are resolved once for the whole process. Boxed types can be used directly as method argument and return types.
+/// @code
+///   auto boxed = JInteger::valueOf(42);
+///   obj.invokeMethod<void>("setLimit", boxed);
+///   jint limit = obj.invokeMethod<JInteger>("getLimit").getValue();
+template<typename T>
+class JBoxed : public JObject
+{
+public:
+    using JniType = jobject;
+    using ValueType = T;
+
+    /// @brief create empty JNI object wrapper
+    JBoxed() = default;
+    /// @brief wrap around an existing boxed JNI object
+    JBoxed(const jobject& initObject)
+        : JObject(initObject)
+    {}
+
+    static inline JBoxed valueOf(T value)
+    {
+        auto env = JVM::getEnv();
+        return valueOfJni(env, value);
+    }
+
+    static JBoxed valueOfJni(JEnv& env, T value)
+    {
+        const auto& info = Private::BoxInfo<T>::get(env);
+        auto obj = env->CallStaticObjectMethod(info.cls, info.valueOf, value);
+        JEnv::checkException(env);
+        JBoxed res { obj };
+        env->DeleteLocalRef(obj);
+        return res;
+    }
+
+    inline T getValue() const
+    {
+        auto env = JVM::getEnv();
+        return getValueJni(env);
+    }
+
+    T getValueJni(JEnv& env) const
+    {
+        if (!jniObject)
+        {
+            throw std::runtime_error(std::string("Can't unbox null ") + getClassName());
+        }
+        return Private::call_primitive_method<T>(env, jniObject, Private::BoxInfo<T>::get(env).unbox);
+    }
+
+    static constexpr const char* getClassName()
+    {
+        return Private::box_traits<T>::className;
+    }
+};
+
+using JBoolean = JBoxed<jboolean>;
+using JByte = JBoxed<jbyte>;
+using JCharacter = JBoxed<jchar>;
+using JShort = JBoxed<jshort>;
+using JInteger = JBoxed<jint>;
+using JLong = JBoxed<jlong>;
+using JFloat = JBoxed<jfloat>;
+using JDouble = JBoxed<jdouble>;
+
+}
+
+#endif // __GUSC_JBOXED_HPP
@@ -8,6 +8,10 @@
 #include "private/cast.hpp"
 #include "private/strutils.hpp"
 #include "private/signature.hpp"
+#include "private/jvalue.hpp"
+#include "private/profile.hpp"
+#include <future>
+#include <initializer_list>
 #include <type_traits>
 
 namespace gusc::Jni
@@ -61,6 +65,11 @@ public:
     JClass createGlobalRef() const
     {
         auto env = JVM::getEnv();
+        return createGlobalRefJni(env);
+    }
+
+    JClass createGlobalRefJni(JEnv& env) const
+    {
         return JClass { static_cast<jclass>(env->NewGlobalRef(jniClass)) };
     }
 
@@ -68,13 +77,23 @@ public:
     JClass createWeakGlobalRef() const
     {
         auto env = JVM::getEnv();
+        return createWeakGlobalRefJni(env);
+    }
+
+    JClass createWeakGlobalRefJni(JEnv& env) const
+    {
         return JClass { static_cast<jclass>(env->NewWeakGlobalRef(jniClass)) };
     }
     
     inline std::string getClassPath() const noexcept
     {
         auto env = JVM::getEnv();
-        jmethodID getNameId = getMethodIdSign("getName", "()Ljava/lang/String;");
+        return getClassPathJni(env);
+    }
+
+    inline std::string getClassPathJni(JEnv& env) const noexcept
+    {
+        jmethodID getNameId = getMethodIdJni(env, "getName", "()Ljava/lang/String;");
         std::string className = JString(static_cast<jstring>(env->CallObjectMethod(jniClass, getNameId)));
         std::size_t pos = 0;
         while ((pos = className.find('.', pos)) != std::string::npos)
@@ -88,11 +107,18 @@ public:
     inline jmethodID getStaticMethodIdSign(const std::string& name, const std::string& signature) const
     {
         auto env = JVM::getEnv();
+        return getStaticMethodIdJni(env, name, signature);
+    }
+
+    inline jmethodID getStaticMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+    {
         auto methodId = env->GetStaticMethodID(jniClass, name.c_str(), signature.c_str());
         if (!methodId)
         {
+            env->ExceptionClear();
             throw std::runtime_error(std::string("Can't find static method ") + name + " with signature " + signature);
         }
+        Private::profile_member(env, JMemberKind::StaticMethod, jniClass, name, signature);
         return methodId;
     }
 
@@ -106,11 +132,18 @@ public:
     inline jmethodID getMethodIdSign(const std::string& name, const std::string& signature) const
     {
         auto env = JVM::getEnv();
+        return getMethodIdJni(env, name, signature);
+    }
+
+    inline jmethodID getMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+    {
         auto methodId = env->GetMethodID(jniClass, name.c_str(), signature.c_str());
         if (!methodId)
         {
+            env->ExceptionClear();
             throw std::runtime_error(std::string("Can't find instance method ") + name + " with signature " + signature);
         }
+        Private::profile_member(env, JMemberKind::Method, jniClass, name, signature);
         return methodId;
     }
 
@@ -124,11 +157,18 @@ public:
     inline jfieldID getStaticFieldIdSign(const std::string& name, const std::string& signature) const
     {
         auto env = JVM::getEnv();
+        return getStaticFieldIdJni(env, name, signature);
+    }
+
+    inline jfieldID getStaticFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+    {
         auto fieldId = env->GetStaticFieldID(jniClass, name.c_str(), signature.c_str());
         if (!fieldId)
         {
+            env->ExceptionClear();
             throw std::runtime_error(std::string("Can't find static field ") + name + " with signature " + signature);
         }
+        Private::profile_member(env, JMemberKind::StaticField, jniClass, name, signature);
         return fieldId;
     }
 
@@ -142,11 +182,18 @@ public:
     inline jfieldID getFieldIdSign(const std::string& name, const std::string& signature) const
     {
         auto env = JVM::getEnv();
+        return getFieldIdJni(env, name, signature);
+    }
+
+    inline jfieldID getFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+    {
         auto fieldId = env->GetFieldID(jniClass, name.c_str(), signature.c_str());
         if (!fieldId)
         {
+            env->ExceptionClear();
             throw std::runtime_error(std::string("Can't find instance field ") + name + " with signature " + signature);
         }
+        Private::profile_member(env, JMemberKind::Field, jniClass, name, signature);
         return fieldId;
     }
 
@@ -177,13 +224,34 @@ public:
         registerNativeMethodSign<TReturn>(name, sign.str, fn);
     }
 
+    /// @brief Register a member function of a class bound with JNativePeer as a native method
+    /// @note defined in JNativeMethod.hpp
+    template<auto Method>
+    void registerNativeMethod(const std::string& name);
+
+    /// @brief Register a table of native methods with a single RegisterNatives call
+    inline void registerNativeMethods(std::initializer_list<JNINativeMethod> methods)
+    {
+        auto env = JVM::getEnv();
+        registerNativeMethodsJni(env, methods);
+    }
+
+    inline void registerNativeMethodsJni(JEnv& env, std::initializer_list<JNINativeMethod> methods)
+    {
+        if (env->RegisterNatives(jniClass, methods.begin(), static_cast<jint>(methods.size())) < 0)
+        {
+            throw std::runtime_error(std::string("Failed to register ") + std::to_string(methods.size()) + " native methods");
+        }
+    }
+
     template<typename... TArgs>
     JObject createObjectJni(JEnv& env, jmethodID methodId, const TArgs&... args) const
     {
         auto obj = env->NewObject(jniClass, methodId, Private::to_jni(std::forward<const TArgs&>(args))...);
+        JEnv::checkException(env);
         if (!obj)
         {
-            throw std::runtime_error(std::string("Failed to reate Java object "));
+            throw std::runtime_error(std::string("Failed to create Java object"));
         }
         return static_cast<JObject>(obj);
     }
@@ -192,7 +260,7 @@ public:
     JObject createObjectSign(const std::string& signature, const TArgs&... args) const
     {
         auto env = JVM::getEnv();
-        const auto methodId = getMethodIdSign("<init>", signature);
+        const auto methodId = getMethodIdJni(env, "<init>", signature);
         return createObjectJni(env, methodId, std::forward<const TArgs&>(args)...);
     }
 
@@ -211,8 +279,13 @@ public:
     >
     invokeMethodJni(JEnv& env, jmethodID methodId, const TArgs&... args) const
     {
+#if defined(GUSC_JNI_JVALUE_INVOKE)
+        invokeMethodJniA<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+#else
+        JEnv::checkBatch(env);
         invokeMethodReturnVoid(env, methodId, std::forward<const TArgs&>(args)...);
-        JEnv::checkException(env);
+        JEnv::checkInvokeException(env);
+#endif
     }
 
     template<typename TReturn, typename... TArgs>
@@ -224,7 +297,7 @@ public:
     invokeMethodSign(const std::string& name, const std::string& signature, const TArgs&... args) const
     {
         auto env = JVM::getEnv();
-        const auto methodId = getStaticMethodIdSign(name, signature);
+        const auto methodId = getStaticMethodIdJni(env, name, signature);
         invokeMethodJni<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
     }
 
@@ -248,9 +321,14 @@ public:
     >
     invokeMethodJni(JEnv& env, jmethodID methodId, const TArgs&... args) const
     {
+#if defined(GUSC_JNI_JVALUE_INVOKE)
+        return invokeMethodJniA<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+#else
+        JEnv::checkBatch(env);
         auto res = invokeMethodReturn<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
-        JEnv::checkException(env);
+        JEnv::checkInvokeException(env);
         return res;
+#endif
     }
 
     template<typename TReturn, typename... TArgs>
@@ -262,7 +340,7 @@ public:
     invokeMethodSign(const std::string& name, const std::string& signature, const TArgs&... args) const
     {
         auto env = JVM::getEnv();
-        const auto methodId = getStaticMethodIdSign(name, signature);
+        const auto methodId = getStaticMethodIdJni(env, name, signature);
         return invokeMethodJni<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
     }
 
@@ -278,6 +356,87 @@ public:
         return invokeMethodSign<TReturn>(name, sign.str, std::forward<const TArgs&>(args)...);
     }
 
+    /// @brief Invoke a static method through CallStatic<Type>MethodA with arguments packed into a jvalue array
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeMethodJniA(JEnv& env, jmethodID methodId, const TArgs&... args) const
+    {
+        JEnv::checkBatch(env);
+        const auto values = Private::to_jvalues(std::forward<const TArgs&>(args)...);
+        invokeMethodReturnVoidA(env, methodId, values.data());
+        JEnv::checkInvokeException(env);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeMethodSignA(const std::string& name, const std::string& signature, const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        const auto methodId = getStaticMethodIdJni(env, name, signature);
+        invokeMethodJniA<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeMethodA(const std::string& name, const TArgs&... args) const
+    {
+        constexpr auto sign = Private::getMethodSignature<TReturn, TArgs...>();
+        invokeMethodSignA<TReturn>(name, sign.str, std::forward<const TArgs&>(args)...);
+    }
+
+    /// @brief Invoke a static method through CallStatic<Type>MethodA with arguments packed into a jvalue array
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeMethodJniA(JEnv& env, jmethodID methodId, const TArgs&... args) const
+    {
+        JEnv::checkBatch(env);
+        const auto values = Private::to_jvalues(std::forward<const TArgs&>(args)...);
+        auto res = invokeMethodReturnA<TReturn>(env, methodId, values.data());
+        JEnv::checkInvokeException(env);
+        return res;
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeMethodSignA(const std::string& name, const std::string& signature, const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        const auto methodId = getStaticMethodIdJni(env, name, signature);
+        return invokeMethodJniA<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeMethodA(const std::string& name, const TArgs&... args) const
+    {
+        constexpr auto sign = Private::getMethodSignature<TReturn, TArgs...>();
+        return invokeMethodSignA<TReturn>(name, sign.str, std::forward<const TArgs&>(args)...);
+    }
+
     template<typename T>
     T getFieldJni(JEnv& env, jfieldID fieldId) const noexcept
     {
@@ -288,7 +447,7 @@ public:
     T getFieldSign(const std::string& name, const std::string& signature) const
     {
         auto env = JVM::getEnv();
-        const auto fieldId = getStaticFieldIdSign(name, signature);
+        const auto fieldId = getStaticFieldIdJni(env, name, signature);
         return getFieldJni<T>(env, fieldId);
     }
 
@@ -309,7 +468,7 @@ public:
     void setFieldSign(const std::string& name, const std::string& signature, const T& value)
     {
         auto env = JVM::getEnv();
-        const auto fieldId = getStaticFieldIdSign(name, signature);
+        const auto fieldId = getStaticFieldIdJni(env, name, signature);
         setFieldJni<T>(env, fieldId, std::forward<const T&>(value));
     }
 
@@ -319,6 +478,52 @@ public:
         constexpr auto sign = Private::getJTypeSignature<T>();
         setFieldSign<T>(name, sign.str, std::forward<const T&>(value));
     }
+
+    /// @brief Non-throwing variants of lookup, static invoke, static field access and object creation (defined in JResult.hpp)
+    JResult<jmethodID> tryGetStaticMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const;
+    JResult<jmethodID> tryGetMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const;
+    JResult<jfieldID> tryGetStaticFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const;
+    JResult<jfieldID> tryGetFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const;
+
+    template<typename... TArgs>
+    JResult<JObject> tryCreateObjectJni(JEnv& env, jmethodID methodId, const TArgs&... args) const;
+
+    template<typename... TArgs>
+    JResult<JObject> tryCreateObjectSign(const std::string& signature, const TArgs&... args) const;
+
+    template<typename... TArgs>
+    JResult<JObject> tryCreateObject(const TArgs&... args) const;
+
+    template<typename TReturn, typename... TArgs>
+    JResult<TReturn> tryInvokeMethodJni(JEnv& env, jmethodID methodId, const TArgs&... args) const;
+
+    template<typename TReturn, typename... TArgs>
+    JResult<TReturn> tryInvokeMethodSign(const std::string& name, const std::string& signature, const TArgs&... args) const;
+
+    template<typename TReturn, typename... TArgs>
+    JResult<TReturn> tryInvokeMethod(const std::string& name, const TArgs&... args) const;
+
+    template<typename T>
+    JResult<T> tryGetFieldSign(const std::string& name, const std::string& signature) const;
+
+    template<typename T>
+    JResult<T> tryGetField(const std::string& name) const;
+
+    template<typename T>
+    JResult<void> trySetFieldSign(const std::string& name, const std::string& signature, const T& value);
+
+    template<typename T>
+    JResult<void> trySetField(const std::string& name, const T& value);
+
+    /// @brief Invoke a static method on a JThreadPool worker without waiting for it (defined in JAsync.hpp)
+    /// Object arguments and the receiver are promoted to global references for the hop, object results come back as global references
+    /// @note the calling thread must already be attached to the JVM, it is not attached implicitly
+    template<typename TReturn, typename... TArgs>
+    std::future<TReturn> invokeMethodAsync(JThreadPool& pool, const std::string& name, const TArgs&... args) const;
+
+    /// @brief Invoke a static method on the default JThreadPool (see JThreadPool::getDefault)
+    template<typename TReturn, typename... TArgs>
+    std::future<TReturn> invokeMethodAsync(const std::string& name, const TArgs&... args) const;
     
 protected:
     jclass jniClass {nullptr };
@@ -503,7 +708,142 @@ protected:
     >
     invokeMethodReturn(JEnv& env, jmethodID methodId, const TArgs&... args) const noexcept
     {
-        return JObject(invokeMethodReturn<jobject>(env, methodId, Private::to_jni(std::forward<const TArgs&>(args))...), true);
+        return JObject(invokeMethodReturn<jobject>(env, methodId, Private::to_jni(std::forward<const TArgs&>(args))...));
+    }
+
+    inline void invokeMethodReturnVoidA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        env->CallStaticVoidMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jboolean>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallStaticBooleanMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jchar>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallStaticCharMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jbyte>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallStaticByteMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jshort>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallStaticShortMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jint>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallStaticIntMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jlong>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallStaticLongMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jfloat>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallStaticFloatMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jdouble>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallStaticDoubleMethodA(jniClass, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+            !std::is_same_v<TReturn, jboolean> &&
+            !std::is_same_v<TReturn, jbyte> &&
+            !std::is_same_v<TReturn, jchar> &&
+            !std::is_same_v<TReturn, jshort> &&
+            !std::is_same_v<TReturn, jint> &&
+            !std::is_same_v<TReturn, jlong> &&
+            !std::is_same_v<TReturn, jfloat> &&
+            !std::is_same_v<TReturn, jdouble> &&
+            !std::is_same_v<TReturn, JString> &&
+            !std::is_same_v<TReturn, JObject>,
+            TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return static_cast<TReturn>(env->CallStaticObjectMethodA(jniClass, methodId, args));
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+            std::is_same_v<TReturn, JString>,
+            TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return JString(invokeMethodReturnA<jstring>(env, methodId, args));
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, JObject>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return JObject(invokeMethodReturnA<jobject>(env, methodId, args));
     }
 
     template<typename T>
@@ -761,9 +1101,11 @@ inline JClass JEnv::getClass(const char* classPath)
     auto cls = env->FindClass(classPath);
     if (!cls)
     {
+        env->ExceptionClear();
         throw std::runtime_error(std::string("Can't find ") + classPath + " Java class");
     }
-    return JClass(cls).createGlobalRef();
+    Private::profile_class(classPath);
+    return JClass(cls).createGlobalRefJni(*this);
 }
 
 inline JClass JEnv::getObjectClass(jobject jniObject)
@@ -776,25 +1118,26 @@ inline JClass JEnv::getObjectClass(jobject jniObject)
     return JClass(*this, cls);
 }
 
-inline void JEnv::checkException(JEnv& env)
+inline jmethodID JObject::getMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const
 {
-    if (env->ExceptionCheck() == JNI_TRUE)
-    {
-        auto ex = JObject(static_cast<jobject>(env->ExceptionOccurred()));
-        env->ExceptionClear();
-        auto message = ex.invokeMethod<JString>("getMessage");
-        throw std::runtime_error(std::string("JNI Exception occured: ") + static_cast<std::string>(message));
-    }
+    return getClass(env).getMethodIdJni(env, name, signature);
 }
 
-inline jmethodID JObject::getMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+inline jfieldID JObject::getFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const
 {
-    return getClass(env).getMethodIdSign(name, signature);
+    return getClass(env).getFieldIdJni(env, name, signature);
 }
 
-inline jfieldID JObject::getFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+inline jmethodID JObject::getNonvirtualMethodIdJni(JEnv& env, jclass cls, const std::string& name, const std::string& signature)
 {
-    return getClass(env).getFieldIdSign(name, signature);
+    auto methodId = env->GetMethodID(cls, name.c_str(), signature.c_str());
+    if (!methodId)
+    {
+        env->ExceptionClear();
+        throw std::runtime_error(std::string("Can't find instance method ") + name + " with signature " + signature);
+    }
+    Private::profile_member(env, JMemberKind::Method, cls, name, signature);
+    return methodId;
 }
 
 inline JClass JObject::getClass(JEnv& env) const noexcept
@@ -826,10 +1169,23 @@ struct JClassS : public JClass
     JClassS(const JClassS& other) = delete;
     JClassS& operator=(const JClassS& other) = delete;
 
+    /// @brief Get a global reference of ClassName that is resolved once and kept for the lifetime of the process
+    static const JClass& getCachedClass()
+    {
+        // Intentionally leaked - global reference must outlive static destructors that may run after JavaVM is gone
+        static const JClass* cls = new JClass { JVM::getEnv().getClass(Private::get_class_path<JClassS<ClassName>>().str) };
+        return *cls;
+    }
+
+    /// @note the constructor ID is resolved once for every argument list
     template<typename... TArgs>
     JObjectS<ClassName> createObjectS(const TArgs&... args) const
     {
-        return JObjectS<ClassName> { createObject(std::forward<const TArgs&>(args)...) };
+        constexpr auto sign = Private::getMethodSignature<void, TArgs...>();
+        // Resolved against this class, getCachedClass() would need FindClass on natively attached threads
+        static const auto methodId = getMethodIdSign("<init>", sign.str);
+        auto env = JVM::getEnv();
+        return JObjectS<ClassName> { createObjectJni(env, methodId, std::forward<const TArgs&>(args)...) };
     }
 
     /// @brief Create a copy of this object with reference type of global ref
@@ -854,4 +1210,9 @@ struct JClassS : public JClass
 
 }
 
+// JEnv::checkException, checkBatch and checkInvokeException are defined together with the exception types
+#include "JException.hpp"
+#include "JResult.hpp"
+#include "JAsync.hpp"
+
 #endif // __GUSC_JCLASS_HPP
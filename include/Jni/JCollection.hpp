@@ -0,0 +1,483 @@
+#ifndef __GUSC_JCOLLECTION_HPP
+#define __GUSC_JCOLLECTION_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JObject.hpp"
+#include "JClass.hpp"
+#include "JString.hpp"
+#include "JArray.hpp"
+#include "JBoxed.hpp"
+#include "private/field.hpp"
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+namespace Private
+{
+
+/// @brief Collection interface classes and method IDs, resolved once and kept for the lifetime of the process
+struct CollectionInfo
+{
+    jclass collectionClass { nullptr };
+    jclass listClass { nullptr };
+    jclass mapClass { nullptr };
+    jclass entryClass { nullptr };
+    jclass iteratorClass { nullptr };
+    jclass numberClass { nullptr };
+    jclass booleanClass { nullptr };
+    jclass characterClass { nullptr };
+    jclass stringClass { nullptr };
+    jmethodID collectionSize { nullptr };
+    jmethodID collectionToArray { nullptr };
+    jmethodID collectionIterator { nullptr };
+    jmethodID listGet { nullptr };
+    jmethodID mapSize { nullptr };
+    jmethodID mapGet { nullptr };
+    jmethodID mapEntrySet { nullptr };
+    jmethodID entryGetKey { nullptr };
+    jmethodID entryGetValue { nullptr };
+    jmethodID iteratorHasNext { nullptr };
+    jmethodID iteratorNext { nullptr };
+    jmethodID byteValue { nullptr };
+    jmethodID shortValue { nullptr };
+    jmethodID intValue { nullptr };
+    jmethodID longValue { nullptr };
+    jmethodID floatValue { nullptr };
+    jmethodID doubleValue { nullptr };
+    jmethodID booleanValue { nullptr };
+    jmethodID charValue { nullptr };
+
+    static const CollectionInfo& get(JNIEnv* env)
+    {
+        static const CollectionInfo info { env };
+        return info;
+    }
+
+private:
+    CollectionInfo(JNIEnv* env)
+    {
+        collectionClass = getGlobalClass(env, "java/util/Collection");
+        listClass = getGlobalClass(env, "java/util/List");
+        mapClass = getGlobalClass(env, "java/util/Map");
+        entryClass = getGlobalClass(env, "java/util/Map$Entry");
+        iteratorClass = getGlobalClass(env, "java/util/Iterator");
+        numberClass = getGlobalClass(env, "java/lang/Number");
+        booleanClass = getGlobalClass(env, "java/lang/Boolean");
+        characterClass = getGlobalClass(env, "java/lang/Character");
+        stringClass = getGlobalClass(env, "java/lang/String");
+        collectionSize = env->GetMethodID(collectionClass, "size", "()I");
+        collectionToArray = env->GetMethodID(collectionClass, "toArray", "()[Ljava/lang/Object;");
+        collectionIterator = env->GetMethodID(collectionClass, "iterator", "()Ljava/util/Iterator;");
+        listGet = env->GetMethodID(listClass, "get", "(I)Ljava/lang/Object;");
+        mapSize = env->GetMethodID(mapClass, "size", "()I");
+        mapGet = env->GetMethodID(mapClass, "get", "(Ljava/lang/Object;)Ljava/lang/Object;");
+        mapEntrySet = env->GetMethodID(mapClass, "entrySet", "()Ljava/util/Set;");
+        entryGetKey = env->GetMethodID(entryClass, "getKey", "()Ljava/lang/Object;");
+        entryGetValue = env->GetMethodID(entryClass, "getValue", "()Ljava/lang/Object;");
+        iteratorHasNext = env->GetMethodID(iteratorClass, "hasNext", "()Z");
+        iteratorNext = env->GetMethodID(iteratorClass, "next", "()Ljava/lang/Object;");
+        byteValue = env->GetMethodID(numberClass, "byteValue", "()B");
+        shortValue = env->GetMethodID(numberClass, "shortValue", "()S");
+        intValue = env->GetMethodID(numberClass, "intValue", "()I");
+        longValue = env->GetMethodID(numberClass, "longValue", "()J");
+        floatValue = env->GetMethodID(numberClass, "floatValue", "()F");
+        doubleValue = env->GetMethodID(numberClass, "doubleValue", "()D");
+        booleanValue = env->GetMethodID(booleanClass, "booleanValue", "()Z");
+        charValue = env->GetMethodID(characterClass, "charValue", "()C");
+    }
+
+    static jclass getGlobalClass(JNIEnv* env, const char* classPath)
+    {
+        auto cls = env->FindClass(classPath);
+        auto global = static_cast<jclass>(env->NewGlobalRef(cls));
+        env->DeleteLocalRef(cls);
+        return global;
+    }
+};
+
+/// @brief Convert a collection element (local reference) into T and release the reference
+/// Primitive types are unboxed, std::string is copied from java.lang.String and wrapper types take over the reference
+template<typename T>
+inline T from_element(JEnv& env, jobject local)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        if (!local)
+        {
+            return {};
+        }
+        if (env->IsInstanceOf(local, CollectionInfo::get(env).stringClass) != JNI_TRUE)
+        {
+            env->DeleteLocalRef(local);
+            throw std::runtime_error("Collection element is not a java.lang.String");
+        }
+        JString str { static_cast<jstring>(local) };
+        env->DeleteLocalRef(local);
+        return str.getStringJni(env);
+    }
+    else if constexpr (is_jni_wrapper_v<T> || std::is_convertible_v<T, jobject>)
+    {
+        return from_jni_local<T>(env, local);
+    }
+    else
+    {
+        if (!local)
+        {
+            throw std::runtime_error("Can't unbox null collection element");
+        }
+        const auto& info = CollectionInfo::get(env);
+        jmethodID unbox { nullptr };
+        jclass boxClass { info.numberClass };
+        const char* boxName { "java.lang.Number" };
+        if constexpr (std::is_same_v<T, jboolean>)
+        {
+            unbox = info.booleanValue;
+            boxClass = info.booleanClass;
+            boxName = "java.lang.Boolean";
+        }
+        else if constexpr (std::is_same_v<T, jchar>)
+        {
+            unbox = info.charValue;
+            boxClass = info.characterClass;
+            boxName = "java.lang.Character";
+        }
+        else if constexpr (std::is_same_v<T, jbyte>)
+        {
+            unbox = info.byteValue;
+        }
+        else if constexpr (std::is_same_v<T, jshort>)
+        {
+            unbox = info.shortValue;
+        }
+        else if constexpr (std::is_same_v<T, jint>)
+        {
+            unbox = info.intValue;
+        }
+        else if constexpr (std::is_same_v<T, jlong>)
+        {
+            unbox = info.longValue;
+        }
+        else if constexpr (std::is_same_v<T, jfloat>)
+        {
+            unbox = info.floatValue;
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, jdouble>, "Unsupported collection element type");
+            unbox = info.doubleValue;
+        }
+        // Calling an unboxing method on an object of another class is undefined behaviour
+        if (env->IsInstanceOf(local, boxClass) != JNI_TRUE)
+        {
+            env->DeleteLocalRef(local);
+            throw std::runtime_error(std::string("Collection element is not a ") + boxName);
+        }
+        // Number methods are used, so that any numeric box can be read as any primitive type
+        const auto res = call_primitive_method<T>(env, local, unbox);
+        env->DeleteLocalRef(local);
+        JEnv::checkException(env);
+        return res;
+    }
+}
+
+}
+
+/// @brief java.util.Iterator wrapper with pre-resolved method IDs
+class JIterator : public JObject
+{
+public:
+    using JniType = jobject;
+
+    JIterator() = default;
+    JIterator(const jobject& initObject)
+        : JObject(initObject)
+    {}
+
+    inline bool hasNext() const
+    {
+        auto env = JVM::getEnv();
+        return hasNextJni(env);
+    }
+
+    inline bool hasNextJni(JEnv& env) const
+    {
+        const auto res = env->CallBooleanMethod(jniObject, Private::CollectionInfo::get(env).iteratorHasNext);
+        JEnv::checkException(env);
+        return res == JNI_TRUE;
+    }
+
+    template<typename T>
+    inline T next() const
+    {
+        auto env = JVM::getEnv();
+        return nextJni<T>(env);
+    }
+
+    template<typename T>
+    inline T nextJni(JEnv& env) const
+    {
+        auto element = env->CallObjectMethod(jniObject, Private::CollectionInfo::get(env).iteratorNext);
+        JEnv::checkException(env);
+        return Private::from_element<T>(env, element);
+    }
+
+    static constexpr const char* getClassName()
+    {
+        return "java.util.Iterator";
+    }
+};
+
+/// @brief java.util.Collection wrapper with pre-resolved method IDs
+/// toVector() copies the collection with a single toArray() call and reads the array in bulk instead of
+/// making a call for every element.
+/// @code
+///   JCollection values { obj.invokeMethod<JObject>("getValues") };
+///   std::vector<jfloat> floats = values.toVector<jfloat>();
+class JCollection : public JObject
+{
+public:
+    using JniType = jobject;
+
+    JCollection() = default;
+    JCollection(const jobject& initObject)
+        : JObject(initObject)
+    {}
+
+    inline jint size() const
+    {
+        auto env = JVM::getEnv();
+        return sizeJni(env);
+    }
+
+    inline jint sizeJni(JEnv& env) const
+    {
+        const auto res = env->CallIntMethod(jniObject, Private::CollectionInfo::get(env).collectionSize);
+        JEnv::checkException(env);
+        return res;
+    }
+
+    inline JObjectArray toArray() const
+    {
+        auto env = JVM::getEnv();
+        return toArrayJni(env);
+    }
+
+    JObjectArray toArrayJni(JEnv& env) const
+    {
+        auto array = static_cast<jobjectArray>(env->CallObjectMethod(jniObject, Private::CollectionInfo::get(env).collectionToArray));
+        JEnv::checkException(env);
+        return Private::from_jni_local<JObjectArray>(env, array);
+    }
+
+    inline JIterator iterator() const
+    {
+        auto env = JVM::getEnv();
+        return iteratorJni(env);
+    }
+
+    JIterator iteratorJni(JEnv& env) const
+    {
+        auto it = env->CallObjectMethod(jniObject, Private::CollectionInfo::get(env).collectionIterator);
+        JEnv::checkException(env);
+        return Private::from_jni_local<JIterator>(env, it);
+    }
+
+    /// @brief Convert all elements to T (primitive types are unboxed)
+    template<typename T>
+    inline std::vector<T> toVector() const
+    {
+        auto env = JVM::getEnv();
+        return toVectorJni<T>(env);
+    }
+
+    template<typename T>
+    std::vector<T> toVectorJni(JEnv& env) const
+    {
+        const auto array = toArrayJni(env);
+        const auto length = env->GetArrayLength(static_cast<jobjectArray>(array));
+        std::vector<T> res;
+        res.reserve(static_cast<std::size_t>(length));
+        for (jsize i = 0; i < length; ++i)
+        {
+            auto element = env->GetObjectArrayElement(array, i);
+            JEnv::checkException(env);
+            res.push_back(Private::from_element<T>(env, element));
+        }
+        return res;
+    }
+
+    static constexpr const char* getClassName()
+    {
+        return "java.util.Collection";
+    }
+};
+
+/// @brief java.util.List wrapper with pre-resolved method IDs
+class JList : public JCollection
+{
+public:
+    using JniType = jobject;
+
+    JList() = default;
+    JList(const jobject& initObject)
+        : JCollection(initObject)
+    {}
+
+    template<typename T>
+    inline T get(jint index) const
+    {
+        auto env = JVM::getEnv();
+        return getJni<T>(env, index);
+    }
+
+    template<typename T>
+    inline T getJni(JEnv& env, jint index) const
+    {
+        auto element = env->CallObjectMethod(jniObject, Private::CollectionInfo::get(env).listGet, index);
+        JEnv::checkException(env);
+        return Private::from_element<T>(env, element);
+    }
+
+    static constexpr const char* getClassName()
+    {
+        return "java.util.List";
+    }
+};
+
+/// @brief java.util.Map wrapper with pre-resolved method IDs
+/// Conversions copy the entry set with a single toArray() call, so every entry costs exactly two calls
+/// (getKey and getValue) plus unboxing.
+/// @code
+///   JMap config { obj.invokeMethod<JObject>("getConfig") };
+///   std::unordered_map<std::string, jint> values = config.toUnorderedMap<std::string, jint>();
+class JMap : public JObject
+{
+public:
+    using JniType = jobject;
+
+    JMap() = default;
+    JMap(const jobject& initObject)
+        : JObject(initObject)
+    {}
+
+    inline jint size() const
+    {
+        auto env = JVM::getEnv();
+        return sizeJni(env);
+    }
+
+    inline jint sizeJni(JEnv& env) const
+    {
+        const auto res = env->CallIntMethod(jniObject, Private::CollectionInfo::get(env).mapSize);
+        JEnv::checkException(env);
+        return res;
+    }
+
+    /// @brief Get value by key, missing object values are returned as empty wrappers
+    template<typename TValue>
+    inline TValue get(jobject key) const
+    {
+        auto env = JVM::getEnv();
+        return getJni<TValue>(env, key);
+    }
+
+    template<typename TValue>
+    inline TValue getJni(JEnv& env, jobject key) const
+    {
+        auto value = env->CallObjectMethod(jniObject, Private::CollectionInfo::get(env).mapGet, key);
+        JEnv::checkException(env);
+        return Private::from_element<TValue>(env, value);
+    }
+
+    inline JCollection entrySet() const
+    {
+        auto env = JVM::getEnv();
+        return entrySetJni(env);
+    }
+
+    JCollection entrySetJni(JEnv& env) const
+    {
+        auto entries = env->CallObjectMethod(jniObject, Private::CollectionInfo::get(env).mapEntrySet);
+        JEnv::checkException(env);
+        return Private::from_jni_local<JCollection>(env, entries);
+    }
+
+    template<typename TKey, typename TValue>
+    inline std::vector<std::pair<TKey, TValue>> toVector() const
+    {
+        auto env = JVM::getEnv();
+        return toVectorJni<TKey, TValue>(env);
+    }
+
+    template<typename TKey, typename TValue>
+    std::vector<std::pair<TKey, TValue>> toVectorJni(JEnv& env) const
+    {
+        std::vector<std::pair<TKey, TValue>> res;
+        forEachEntryJni<TKey, TValue>(env, [&res](TKey&& key, TValue&& value) {
+            res.emplace_back(std::move(key), std::move(value));
+        });
+        return res;
+    }
+
+    template<typename TKey, typename TValue, typename THash = std::hash<TKey>>
+    inline std::unordered_map<TKey, TValue, THash> toUnorderedMap() const
+    {
+        auto env = JVM::getEnv();
+        return toUnorderedMapJni<TKey, TValue, THash>(env);
+    }
+
+    template<typename TKey, typename TValue, typename THash = std::hash<TKey>>
+    std::unordered_map<TKey, TValue, THash> toUnorderedMapJni(JEnv& env) const
+    {
+        std::unordered_map<TKey, TValue, THash> res;
+        forEachEntryJni<TKey, TValue>(env, [&res](TKey&& key, TValue&& value) {
+            res.emplace(std::move(key), std::move(value));
+        });
+        return res;
+    }
+
+    static constexpr const char* getClassName()
+    {
+        return "java.util.Map";
+    }
+
+private:
+    template<typename TKey, typename TValue, typename TFn>
+    void forEachEntryJni(JEnv& env, TFn&& fn) const
+    {
+        const auto& info = Private::CollectionInfo::get(env);
+        const auto entries = entrySetJni(env).toArrayJni(env);
+        const auto length = env->GetArrayLength(static_cast<jobjectArray>(entries));
+        for (jsize i = 0; i < length; ++i)
+        {
+            auto entry = env->GetObjectArrayElement(entries, i);
+            JEnv::checkException(env);
+            auto keyElement = env->CallObjectMethod(entry, info.entryGetKey);
+            auto valueElement = env->ExceptionCheck() == JNI_TRUE ? nullptr : env->CallObjectMethod(entry, info.entryGetValue);
+            env->DeleteLocalRef(entry);
+            if (env->ExceptionCheck() == JNI_TRUE)
+            {
+                if (keyElement)
+                {
+                    env->DeleteLocalRef(keyElement);
+                }
+                JEnv::checkException(env);
+            }
+            auto key = Private::from_element<TKey>(env, keyElement);
+            auto value = Private::from_element<TValue>(env, valueElement);
+            fn(std::move(key), std::move(value));
+        }
+    }
+};
+
+}
+
+#endif // __GUSC_JCOLLECTION_HPP
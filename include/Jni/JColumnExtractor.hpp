@@ -0,0 +1,258 @@
+#ifndef __GUSC_JCOLUMNEXTRACTOR_HPP
+#define __GUSC_JCOLUMNEXTRACTOR_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JClass.hpp"
+#include "JThreadPool.hpp"
+#include "private/signature.hpp"
+#include "private/field.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+/// @brief Bulk reader of primitive fields from a collection of Java objects into contiguous native columns
+/// (struct of arrays). Field IDs are resolved once, elements are read in bounded local frames and large
+/// inputs can be split between the calling thread and JThreadPool workers.
+/// @code
+///   // class Sample { long t; float v; }
+///   static const JColumnExtractor<jlong, jfloat> extractor { cls, "t", "v" };
+///   auto [t, v] = extractor.extract(samples);
+template<typename... TColumns>
+class JColumnExtractor final
+{
+    static_assert(sizeof...(TColumns) > 0, "At least one column is required");
+    static_assert((!Private::is_jni_wrapper_v<TColumns> && ...), "Only primitive field types can be extracted into columns");
+
+    template<typename>
+    using FieldName = const char*;
+
+public:
+    using Columns = std::tuple<std::vector<TColumns>...>;
+
+    /// @brief Number of elements read between PushLocalFrame and PopLocalFrame
+    static constexpr jint frameSize { 256 };
+
+    /// @brief resolve field IDs (the signatures are automatically generated at compile time from TColumns... types)
+    JColumnExtractor(const JClass& initClass, FieldName<TColumns>... names)
+    {
+        auto env = JVM::getEnv();
+        const std::array<const char*, sizeof...(TColumns)> fieldNames { names... };
+        resolveJni(env, initClass, fieldNames, std::index_sequence_for<TColumns...>{});
+        cls = initClass.createGlobalRefJni(env);
+        // Array class of the bound class, used to skip the element checks for typed arrays
+        auto emptyArray = env->NewObjectArray(0, initClass, nullptr);
+        if (!emptyArray)
+        {
+            JEnv::checkException(env);
+            throw std::runtime_error("Failed to create Java object array");
+        }
+        auto emptyArrayClass = env->GetObjectClass(emptyArray);
+        arrayClass = JClass { emptyArrayClass }.createGlobalRefJni(env);
+        env->DeleteLocalRef(emptyArrayClass);
+        env->DeleteLocalRef(emptyArray);
+    }
+    JColumnExtractor(const JColumnExtractor&) = default;
+    JColumnExtractor& operator=(const JColumnExtractor&) = default;
+    JColumnExtractor(JColumnExtractor&&) = default;
+    JColumnExtractor& operator=(JColumnExtractor&&) = default;
+    ~JColumnExtractor() = default;
+
+    /// @brief Extract columns from an object array (JObjectArray and JObjectArrayS convert to jobjectArray)
+    /// @param threadCount - number of chunks to split the array between, the calling thread reads the first one
+    /// and the rest are read by JThreadPool::getDefault() workers
+    Columns extract(jobjectArray array, std::size_t threadCount = 1) const
+    {
+        auto env = JVM::getEnv();
+        return extractJni(env, array, threadCount);
+    }
+
+    /// @brief Extract columns from an object array, split between the calling thread and every worker of the pool
+    /// @note don't call it from a worker of the same pool, the calling thread blocks until all chunks are read
+    Columns extract(JThreadPool& pool, jobjectArray array) const
+    {
+        auto env = JVM::getEnv();
+        return extractJni(env, pool, array);
+    }
+
+    Columns extractJni(JEnv& env, jobjectArray array, std::size_t threadCount = 1) const
+    {
+        if (threadCount <= 1)
+        {
+            return extractChunksJni(env, nullptr, array, 1);
+        }
+        return extractChunksJni(env, &JThreadPool::getDefault(), array, threadCount);
+    }
+
+    Columns extractJni(JEnv& env, JThreadPool& pool, jobjectArray array) const
+    {
+        return extractChunksJni(env, &pool, array, pool.size() + 1);
+    }
+
+    /// @brief Extract columns from a java.util.Collection (i.e. List), the collection is copied with toArray() first
+    Columns extractCollection(jobject collection, std::size_t threadCount = 1) const
+    {
+        auto env = JVM::getEnv();
+        return extractCollectionJni(env, collection, threadCount);
+    }
+
+    Columns extractCollection(JThreadPool& pool, jobject collection) const
+    {
+        auto env = JVM::getEnv();
+        auto array = toArrayJni(env, collection);
+        auto res = extractJni(env, pool, array);
+        env->DeleteLocalRef(array);
+        return res;
+    }
+
+    Columns extractCollectionJni(JEnv& env, jobject collection, std::size_t threadCount = 1) const
+    {
+        auto array = toArrayJni(env, collection);
+        auto res = extractJni(env, array, threadCount);
+        env->DeleteLocalRef(array);
+        return res;
+    }
+
+    /// @brief Extract elements [begin, end) of the array into already sized columns
+    /// @throws std::runtime_error on null elements and on elements that are not instances of the bound class
+    void extractRangeJni(JEnv& env, jobjectArray array, Columns& columns, std::size_t begin, std::size_t end) const
+    {
+        // The JVM guarantees the element type of an array of the bound class (or its subclass), other arrays
+        // (i.e. Object[] from toArray()) are checked element by element
+        const auto checkElements = env->IsInstanceOf(array, arrayClass) != JNI_TRUE;
+        for (auto frameBegin = begin; frameBegin < end; frameBegin += frameSize)
+        {
+            const auto frameEnd = std::min(end, frameBegin + frameSize);
+            if (env->PushLocalFrame(frameSize) != JNI_OK)
+            {
+                env->ExceptionClear();
+                throw std::runtime_error("Failed to allocate local reference frame");
+            }
+            for (auto i = frameBegin; i < frameEnd; ++i)
+            {
+                auto obj = env->GetObjectArrayElement(array, static_cast<jsize>(i));
+                if (!obj)
+                {
+                    env->PopLocalFrame(nullptr);
+                    throw std::runtime_error(std::string("Null element at index ") + std::to_string(i));
+                }
+                if (checkElements && env->IsInstanceOf(obj, cls) != JNI_TRUE)
+                {
+                    env->PopLocalFrame(nullptr);
+                    throw std::runtime_error(std::string("Element at index ") + std::to_string(i) + " is not an instance of the extracted class");
+                }
+                readJni(env, obj, columns, i, std::index_sequence_for<TColumns...>{});
+            }
+            env->PopLocalFrame(nullptr);
+        }
+    }
+
+    inline const JClass& getClass() const noexcept
+    {
+        return cls;
+    }
+
+private:
+    std::array<jfieldID, sizeof...(TColumns)> fieldIds {};
+    JClass cls { nullptr };
+    JClass arrayClass { nullptr };
+
+    static jobjectArray toArrayJni(JEnv& env, jobject collection)
+    {
+        auto collectionClass = env->GetObjectClass(collection);
+        const auto toArrayId = env->GetMethodID(collectionClass, "toArray", "()[Ljava/lang/Object;");
+        env->DeleteLocalRef(collectionClass);
+        if (!toArrayId)
+        {
+            env->ExceptionClear();
+            throw std::runtime_error("Object is not a java.util.Collection");
+        }
+        auto array = static_cast<jobjectArray>(env->CallObjectMethod(collection, toArrayId));
+        JEnv::checkException(env);
+        return array;
+    }
+
+    Columns extractChunksJni(JEnv& env, JThreadPool* pool, jobjectArray array, std::size_t chunkCount) const
+    {
+        const auto length = static_cast<std::size_t>(env->GetArrayLength(array));
+        Columns columns;
+        std::apply([length](auto&... column) {
+            (column.resize(length), ...);
+        }, columns);
+        chunkCount = std::max<std::size_t>(1, std::min(chunkCount, length / frameSize));
+        if (!pool || chunkCount == 1)
+        {
+            extractRangeJni(env, array, columns, 0, length);
+            return columns;
+        }
+        // Local references can't be shared between threads
+        auto globalArray = static_cast<jobjectArray>(env->NewGlobalRef(array));
+        const auto chunk = (length + chunkCount - 1) / chunkCount;
+        std::vector<std::future<void>> chunks;
+        chunks.reserve(chunkCount - 1);
+        for (std::size_t c = 1; c < chunkCount; ++c)
+        {
+            const auto begin = std::min(length, c * chunk);
+            const auto end = std::min(length, begin + chunk);
+            chunks.push_back(pool->submit([this, globalArray, &columns, begin, end](JEnv& workerEnv) {
+                extractRangeJni(workerEnv, globalArray, columns, begin, end);
+            }));
+        }
+        std::exception_ptr error;
+        try
+        {
+            extractRangeJni(env, globalArray, columns, 0, std::min(length, chunk));
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        // Every chunk has to finish before the columns and the array go away
+        for (auto& result : chunks)
+        {
+            try
+            {
+                result.get();
+            }
+            catch (...)
+            {
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+        }
+        env->DeleteGlobalRef(globalArray);
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+        return columns;
+    }
+
+    template<std::size_t... I>
+    inline void resolveJni(JEnv& env, const JClass& initClass, const std::array<const char*, sizeof...(TColumns)>& names, std::index_sequence<I...>)
+    {
+        ((fieldIds[I] = initClass.getFieldIdJni(env, names[I], Private::getJTypeSignature<TColumns>().str)), ...);
+    }
+
+    template<std::size_t... I>
+    inline void readJni(JEnv& env, jobject obj, Columns& columns, std::size_t index, std::index_sequence<I...>) const noexcept
+    {
+        ((std::get<I>(columns)[index] = Private::getFieldValue<TColumns>(env, obj, fieldIds[I])), ...);
+    }
+};
+
+}
+
+#endif // __GUSC_JCOLUMNEXTRACTOR_HPP
@@ -0,0 +1,166 @@
+#ifndef __GUSC_JCONSTANT_HPP
+#define __GUSC_JCONSTANT_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JClass.hpp"
+#include "JString.hpp"
+#include "private/signature.hpp"
+#include "private/field.hpp"
+#include <string>
+#include <type_traits>
+
+namespace gusc::Jni
+{
+
+namespace Private
+{
+
+/// @brief Java type and reader of a constant stored natively as T (primitives are stored as is, strings are copied)
+template<typename T>
+struct constant_traits
+{
+    static_assert(!is_jni_wrapper_v<T>, "Constants can only be primitive types or std::string");
+
+    static constexpr auto signature = getJTypeSignature<T>();
+
+    static inline T read(JEnv& env, jclass cls, jfieldID fieldId) noexcept
+    {
+        return getStaticFieldValue<T>(env, cls, fieldId);
+    }
+};
+
+template<>
+struct constant_traits<std::string>
+{
+    static constexpr auto signature = getJTypeSignature<JString>();
+
+    static inline std::string read(JEnv& env, jclass cls, jfieldID fieldId)
+    {
+        auto local = static_cast<jstring>(env->GetStaticObjectField(cls, fieldId));
+        if (!local)
+        {
+            return {};
+        }
+        auto res = JString { local }.getStringJni(env);
+        env->DeleteLocalRef(local);
+        return res;
+    }
+};
+
+template<typename T>
+inline T read_constant(JEnv& env, const JClass& cls, const char* name)
+{
+    const auto fieldId = cls.getStaticFieldIdJni(env, name, constant_traits<T>::signature.str);
+    return constant_traits<T>::read(env, cls, fieldId);
+}
+
+}
+
+/// @brief Snapshot of a static (final) field, the value is read once when the constant is loaded and
+/// get() is a plain member read afterwards
+/// @code
+///   static const JStaticConstant<jint> bufferSize { cls, "BUFFER_SIZE" };
+///   for (...) { process(bufferSize.get()); }
+template<typename T>
+class JStaticConstant final
+{
+public:
+    /// @brief create an unloaded constant
+    JStaticConstant() = default;
+    /// @brief read the static field value (the signature is automatically generated at compile time from T type)
+    JStaticConstant(const JClass& cls, const char* name)
+    {
+        load(cls, name);
+    }
+    JStaticConstant(const JStaticConstant&) = default;
+    JStaticConstant& operator=(const JStaticConstant&) = default;
+    JStaticConstant(JStaticConstant&&) = default;
+    JStaticConstant& operator=(JStaticConstant&&) = default;
+    ~JStaticConstant() = default;
+
+    inline void load(const JClass& cls, const char* name)
+    {
+        auto env = JVM::getEnv();
+        loadJni(env, cls, name);
+    }
+
+    inline void loadJni(JEnv& env, const JClass& cls, const char* name)
+    {
+        value = Private::read_constant<T>(env, cls, name);
+        loaded = true;
+    }
+
+    inline bool isLoaded() const noexcept
+    {
+        return loaded;
+    }
+
+    inline const T& get() const noexcept
+    {
+        return value;
+    }
+
+    inline operator const T&() const noexcept
+    {
+        return value;
+    }
+
+    static constexpr const char* getSignature()
+    {
+        return Private::constant_traits<T>::signature.str;
+    }
+
+private:
+    T value {};
+    bool loaded { false };
+};
+
+/// @brief Pair of a C++ struct member and a Java static field name (see loadConstants)
+template<typename TStruct, typename TMember>
+struct JConstantField
+{
+    TMember TStruct::* member;
+    const char* name;
+};
+
+/// @brief Map struct member to a Java static field
+template<typename TStruct, typename TMember>
+constexpr JConstantField<TStruct, TMember> mapConstant(TMember TStruct::* member, const char* name) noexcept
+{
+    return { member, name };
+}
+
+/// @brief Read many static fields of one class into a struct (manifest of the class constants)
+/// @code
+///   struct AudioConstants
+///   {
+///       jint bufferSize;
+///       jint sampleRate;
+///       std::string version;
+///   };
+///   static const auto constants = loadConstants(
+///       cls,
+///       mapConstant(&AudioConstants::bufferSize, "BUFFER_SIZE"),
+///       mapConstant(&AudioConstants::sampleRate, "SAMPLE_RATE"),
+///       mapConstant(&AudioConstants::version, "VERSION")
+///   );
+template<typename TStruct, typename... TMembers>
+inline TStruct loadConstants(const JClass& cls, JConstantField<TStruct, TMembers>... fields)
+{
+    auto env = JVM::getEnv();
+    return loadConstantsJni(env, cls, fields...);
+}
+
+template<typename TStruct, typename... TMembers>
+inline TStruct loadConstantsJni(JEnv& env, const JClass& cls, JConstantField<TStruct, TMembers>... fields)
+{
+    TStruct out {};
+    ((out.*(fields.member) = Private::read_constant<TMembers>(env, cls, fields.name)), ...);
+    return out;
+}
+
+}
+
+#endif // __GUSC_JCONSTANT_HPP
@@ -0,0 +1,303 @@
+#ifndef __GUSC_JCOROUTINE_HPP
+#define __GUSC_JCOROUTINE_HPP 1
+
+#if __cplusplus < 202002L
+#error "JCoroutine.hpp requires C++20 (enable the Jni_Coroutines build option)"
+#endif
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JObject.hpp"
+#include "JClass.hpp"
+#include "JException.hpp"
+#include "JThreadPool.hpp"
+#include "JCollection.hpp"
+#include <atomic>
+#include <coroutine>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace gusc::Jni
+{
+
+/// @brief Resumes a coroutine suspended on a CompletableFuture, an empty executor resumes it inline on the
+/// Java thread that completed the future
+using JResumeExecutor = std::function<void(std::coroutine_handle<>)>;
+
+/// @brief Resume awaiting coroutines on a JThreadPool worker
+inline JResumeExecutor resumeOn(JThreadPool& pool)
+{
+    return [&pool](std::coroutine_handle<> handle) {
+        pool.post([handle](JEnv&) {
+            handle.resume();
+        });
+    };
+}
+
+namespace Private
+{
+
+/// @brief Shared between an awaiter and the lv.gusc.jni.NativeCompletion callback
+struct CompletionState
+{
+    enum Phase : int
+    {
+        Suspending,
+        Suspended,
+        Completed
+    };
+
+    std::coroutine_handle<> handle;
+    JResumeExecutor executor;
+    jobject result { nullptr };
+    jobject error { nullptr };
+    std::atomic<int> phase { Suspending };
+};
+
+/// @brief NativeCompletion and CompletableFuture classes and method IDs, resolved once
+struct CompletionInfo
+{
+    jclass completionClass { nullptr };
+    jmethodID completionInit { nullptr };
+    jmethodID whenComplete { nullptr };
+    jmethodID isDone { nullptr };
+    jmethodID join { nullptr };
+    jclass completionExceptionClass { nullptr };
+    jmethodID getCause { nullptr };
+
+    static const CompletionInfo& get(JEnv& env)
+    {
+        // Leaked intentionally - global references must outlive static destructors
+        static const CompletionInfo* info = new CompletionInfo(env);
+        return *info;
+    }
+
+    /// @brief Cause of a CompletionException (what the asynchronous stage actually threw), other throwables are kept
+    jthrowable unwrap(JNIEnv* env, jthrowable error) const
+    {
+        if (env->IsInstanceOf(error, completionExceptionClass) != JNI_TRUE)
+        {
+            return error;
+        }
+        auto cause = static_cast<jthrowable>(env->CallObjectMethod(error, getCause));
+        if (!cause)
+        {
+            env->ExceptionClear();
+            return error;
+        }
+        env->DeleteLocalRef(error);
+        return cause;
+    }
+
+private:
+    explicit CompletionInfo(JEnv& env)
+    {
+        auto completion = env.getClass("lv/gusc/jni/NativeCompletion");
+        completionClass = static_cast<jclass>(env->NewGlobalRef(completion));
+        completionInit = completion.getMethodIdJni(env, "<init>", "(J)V");
+        const JNINativeMethod complete { "complete", "(JLjava/lang/Object;Ljava/lang/Throwable;)V", reinterpret_cast<void*>(&onComplete) };
+        if (env->RegisterNatives(completionClass, &complete, 1) != JNI_OK)
+        {
+            env->ExceptionClear();
+            throw std::runtime_error("Failed to register lv.gusc.jni.NativeCompletion native methods");
+        }
+        auto future = env.getClass("java/util/concurrent/CompletableFuture");
+        whenComplete = future.getMethodIdJni(env, "whenComplete", "(Ljava/util/function/BiConsumer;)Ljava/util/concurrent/CompletableFuture;");
+        isDone = future.getMethodIdJni(env, "isDone", "()Z");
+        join = future.getMethodIdJni(env, "join", "()Ljava/lang/Object;");
+        auto completionException = env.getClass("java/util/concurrent/CompletionException");
+        completionExceptionClass = static_cast<jclass>(env->NewGlobalRef(completionException));
+        getCause = env.getClass("java/lang/Throwable").getMethodIdJni(env, "getCause", "()Ljava/lang/Throwable;");
+    }
+
+    static void JNICALL onComplete(JNIEnv* env, jclass /*cls*/, jlong handle, jobject result, jthrowable error)
+    {
+        auto state = reinterpret_cast<CompletionState*>(handle);
+        state->result = result ? env->NewGlobalRef(result) : nullptr;
+        state->error = error ? env->NewGlobalRef(error) : nullptr;
+        // While await_suspend is still running it resumes the coroutine itself
+        if (state->phase.exchange(CompletionState::Completed) != CompletionState::Suspended)
+        {
+            return;
+        }
+        JEnvScope scope { env };
+        try
+        {
+            auto executor = std::move(state->executor);
+            if (executor)
+            {
+                executor(state->handle);
+            }
+            else
+            {
+                state->handle.resume();
+            }
+        }
+        catch (...)
+        {
+            // Errors can't be propagated into the Java thread that completed the future
+        }
+    }
+};
+
+/// @brief Convert a completion result (global reference) into T: wrappers keep a global reference,
+/// std::string is copied and primitives are unboxed
+template<typename T>
+inline T from_completion(JEnv& env, jobject global)
+{
+    if constexpr (is_jni_wrapper_v<T>)
+    {
+        T res { static_cast<jni_type_t<T>>(global) };
+        if (global)
+        {
+            env->DeleteGlobalRef(global);
+        }
+        return res;
+    }
+    else
+    {
+        auto local = global ? env->NewLocalRef(global) : nullptr;
+        if (global)
+        {
+            env->DeleteGlobalRef(global);
+        }
+        return from_element<T>(env, local);
+    }
+}
+
+}
+
+/// @brief Awaiter of a java.util.concurrent.CompletableFuture
+/// Completion is delivered through a lv.gusc.jni.NativeCompletion callback registered with whenComplete,
+/// no thread is blocked while the future is pending. Exceptional completion is rethrown as JException
+/// (or the type registered in JExceptionRegistry) from co_await.
+template<typename T = JObject>
+class JFutureAwaiter final
+{
+public:
+    JFutureAwaiter(const JObject& initFuture, JResumeExecutor executor = {})
+        : state(std::make_unique<Private::CompletionState>())
+    {
+        auto env = JVM::getEnv();
+        future = initFuture.createGlobalRefJni(env);
+        state->executor = std::move(executor);
+    }
+
+    bool await_ready()
+    {
+        auto env = JVM::getEnv();
+        return env->CallBooleanMethod(future, Private::CompletionInfo::get(env).isDone) == JNI_TRUE;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        state->handle = handle;
+        auto env = JVM::getEnv();
+        const auto& info = Private::CompletionInfo::get(env);
+        auto completion = env->NewObject(info.completionClass, info.completionInit, reinterpret_cast<jlong>(state.get()));
+        JEnv::checkException(env);
+        auto stage = env->CallObjectMethod(future, info.whenComplete, completion);
+        env->DeleteLocalRef(completion);
+        if (stage)
+        {
+            env->DeleteLocalRef(stage);
+        }
+        JEnv::checkException(env);
+        // Resume right away if the future completed while the callback was being registered
+        return state->phase.exchange(Private::CompletionState::Suspended) != Private::CompletionState::Completed;
+    }
+
+    T await_resume()
+    {
+        auto env = JVM::getEnv();
+        const auto& info = Private::CompletionInfo::get(env);
+        if (state->phase.load() != Private::CompletionState::Completed)
+        {
+            // Future was already done in await_ready, join() returns without blocking
+            auto local = env->CallObjectMethod(future, info.join);
+            if (auto error = env->ExceptionOccurred())
+            {
+                env->ExceptionClear();
+                state->error = env->NewGlobalRef(error);
+                env->DeleteLocalRef(error);
+            }
+            else if (local)
+            {
+                state->result = env->NewGlobalRef(local);
+                env->DeleteLocalRef(local);
+            }
+        }
+        if (state->error)
+        {
+            auto error = info.unwrap(env, static_cast<jthrowable>(env->NewLocalRef(state->error)));
+            env->DeleteGlobalRef(std::exchange(state->error, nullptr));
+            if (state->result)
+            {
+                env->DeleteGlobalRef(std::exchange(state->result, nullptr));
+            }
+            env->Throw(error);
+            env->DeleteLocalRef(error);
+            JEnv::checkException(env);
+        }
+        return Private::from_completion<T>(env, std::exchange(state->result, nullptr));
+    }
+
+private:
+    JObject future;
+    std::unique_ptr<Private::CompletionState> state;
+};
+
+/// @brief java.util.concurrent.CompletableFuture wrapper that can be awaited in a C++20 coroutine
+/// @code
+///   MyTask loadPreset(JObject loader)
+///   {
+///       JCompletableFuture future { loader.invokeMethod<JCompletableFuture>("loadAsync") };
+///       JString preset = co_await future.await<JString>(resumeOn(pool));
+///       ...
+///   }
+class JCompletableFuture : public JObject
+{
+public:
+    using JniType = jobject;
+
+    /// @brief create empty JNI object wrapper
+    JCompletableFuture() = default;
+    /// @brief wrap around an existing JNI CompletableFuture object
+    JCompletableFuture(const jobject& initObject)
+        : JObject(initObject)
+    {}
+
+    /// @brief Register the NativeCompletion native callback ahead of the first co_await
+    /// @note call it on a thread that can see application classes (i.e. in JNI_OnLoad), FindClass on
+    /// natively attached threads only sees system classes
+    static inline void init()
+    {
+        auto env = JVM::getEnv();
+        Private::CompletionInfo::get(env);
+    }
+
+    /// @brief Await the result converted to T on the given executor
+    template<typename T = JObject>
+    inline JFutureAwaiter<T> await(JResumeExecutor executor = {}) const
+    {
+        return JFutureAwaiter<T> { *this, std::move(executor) };
+    }
+
+    inline JFutureAwaiter<JObject> operator co_await() const
+    {
+        return JFutureAwaiter<JObject> { *this };
+    }
+
+    static constexpr const char* getClassName()
+    {
+        return "java.util.concurrent.CompletableFuture";
+    }
+};
+
+}
+
+#endif // __GUSC_JCOROUTINE_HPP
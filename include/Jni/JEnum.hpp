@@ -0,0 +1,235 @@
+#ifndef __GUSC_JENUM_HPP
+#define __GUSC_JENUM_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JObject.hpp"
+#include "JClass.hpp"
+#include "private/signature.hpp"
+#include "private/strutils.hpp"
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+/// @brief Pair of a C++ enum value and the name of a Java enum constant
+template<typename TEnum>
+struct JEnumConstant
+{
+    TEnum value;
+    const char* name;
+};
+
+/// @brief Maps C++ enum values to the constants of a Java enum
+/// The Java constants are loaded once as global references, C++ -> Java is a hash lookup, Java -> C++ reads
+/// the ordinal field of the constant and verifies it by identity, so no Java methods are called after the table
+/// is loaded. Mapped enums can be used directly as method arguments.
+/// @code
+///   enum class FilterType { LowPass, HighPass };
+///   template<>
+///   struct gusc::Jni::JEnumTraits<FilterType>
+///   {
+///       static constexpr const char* getClassName() { return "my.package.FilterType"; }
+///       static constexpr JEnumConstant<FilterType> constants[] {
+///           { FilterType::LowPass, "LOW_PASS" },
+///           { FilterType::HighPass, "HIGH_PASS" }
+///       };
+///   };
+///   filter.invokeMethod<void>("setType", FilterType::HighPass);
+///   auto type = filter.invokeMethod<JEnum<FilterType>>("getType").getValue();
+template<typename TEnum>
+class JEnumMapping final
+{
+    static_assert(std::is_enum_v<TEnum>, "JEnumMapping can only be used with enum types");
+
+public:
+    using Traits = JEnumTraits<TEnum>;
+
+    JEnumMapping() = delete;
+
+    /// @brief Load the constant table ahead of the first use (i.e. in JNI_OnLoad)
+    static inline void load()
+    {
+        auto env = JVM::getEnv();
+        getTable(env);
+    }
+
+    /// @brief Get the Java enum constant (global reference owned by the mapping)
+    static jobject toJni(TEnum value)
+    {
+        auto env = JVM::getEnv();
+        const auto& table = getTable(env);
+        const auto it = table.ordinals.find(static_cast<Underlying>(value));
+        if (it == table.ordinals.end())
+        {
+            throw std::invalid_argument(std::string("Enum value is not mapped to ") + Traits::getClassName());
+        }
+        return table.constants[static_cast<std::size_t>(it->second)];
+    }
+
+    static inline TEnum fromJni(jobject obj)
+    {
+        auto env = JVM::getEnv();
+        return fromJni(env, obj);
+    }
+
+    /// @brief Get the C++ value of a Java enum constant
+    static TEnum fromJni(JEnv& env, jobject obj)
+    {
+        if (!obj)
+        {
+            throw std::invalid_argument(std::string("Can't map null ") + Traits::getClassName());
+        }
+        const auto& table = getTable(env);
+        if (table.ordinalField)
+        {
+            const auto ordinal = env->GetIntField(obj, table.ordinalField);
+            if (ordinal >= 0 && static_cast<std::size_t>(ordinal) < table.constants.size()
+                && env->IsSameObject(obj, table.constants[static_cast<std::size_t>(ordinal)]) == JNI_TRUE)
+            {
+                return fromOrdinal(ordinal);
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < table.constants.size(); ++i)
+            {
+                if (table.constants[i] && env->IsSameObject(obj, table.constants[i]) == JNI_TRUE)
+                {
+                    return fromOrdinal(static_cast<jint>(i));
+                }
+            }
+        }
+        throw std::invalid_argument(std::string("Java enum constant is not mapped to C++ (") + Traits::getClassName() + ")");
+    }
+
+    /// @brief Get the C++ value by Java ordinal
+    static TEnum fromOrdinal(jint ordinal)
+    {
+        auto env = JVM::getEnv();
+        const auto& table = getTable(env);
+        if (ordinal < 0 || static_cast<std::size_t>(ordinal) >= table.values.size() || !table.constants[static_cast<std::size_t>(ordinal)])
+        {
+            throw std::out_of_range(std::string("Ordinal ") + std::to_string(ordinal) + " is not mapped (" + Traits::getClassName() + ")");
+        }
+        return table.values[static_cast<std::size_t>(ordinal)];
+    }
+
+    /// @brief Get the Java ordinal of a C++ value
+    static jint getOrdinal(TEnum value)
+    {
+        auto env = JVM::getEnv();
+        const auto& table = getTable(env);
+        const auto it = table.ordinals.find(static_cast<Underlying>(value));
+        if (it == table.ordinals.end())
+        {
+            throw std::invalid_argument(std::string("Enum value is not mapped to ") + Traits::getClassName());
+        }
+        return it->second;
+    }
+
+    static inline const JClass& getClass()
+    {
+        auto env = JVM::getEnv();
+        return getTable(env).cls;
+    }
+
+private:
+    using Underlying = std::underlying_type_t<TEnum>;
+
+    struct Table
+    {
+        JClass cls { nullptr };
+        jfieldID ordinalField { nullptr };
+        // Indexed by Java ordinal, unmapped constants are nullptr
+        std::vector<jobject> constants;
+        std::vector<TEnum> values;
+        std::unordered_map<Underlying, jint> ordinals;
+
+        explicit Table(JEnv& env)
+        {
+            constexpr auto classPath = Private::get_class_path<Traits>();
+            constexpr auto signature = Private::getJTypeSignature<TEnum>();
+            cls = env.getClass(classPath.str);
+            auto enumClass = env->FindClass("java/lang/Enum");
+            const auto ordinalMethod = env->GetMethodID(enumClass, "ordinal", "()I");
+            ordinalField = env->GetFieldID(enumClass, "ordinal", "I");
+            if (!ordinalField)
+            {
+                env->ExceptionClear();
+            }
+            env->DeleteLocalRef(enumClass);
+            for (const auto& constant : Traits::constants)
+            {
+                const auto fieldId = env->GetStaticFieldID(cls, constant.name, signature.str);
+                if (!fieldId)
+                {
+                    env->ExceptionClear();
+                    throw std::runtime_error(std::string("Can't find enum constant ") + constant.name + " in " + Traits::getClassName());
+                }
+                auto local = env->GetStaticObjectField(cls, fieldId);
+                const auto ordinal = env->CallIntMethod(local, ordinalMethod);
+                const auto index = static_cast<std::size_t>(ordinal);
+                if (index >= constants.size())
+                {
+                    constants.resize(index + 1, nullptr);
+                    values.resize(index + 1, constant.value);
+                }
+                constants[index] = env->NewGlobalRef(local);
+                values[index] = constant.value;
+                ordinals.emplace(static_cast<Underlying>(constant.value), ordinal);
+                env->DeleteLocalRef(local);
+            }
+        }
+    };
+
+    static const Table& getTable(JEnv& env)
+    {
+        // Leaked intentionally - the constants are global references that are used until the very end of the process
+        static const Table* table = new Table(env);
+        return *table;
+    }
+};
+
+/// @brief Java enum object wrapper for C++ enums mapped with JEnumTraits, use it as a method return type
+template<typename TEnum>
+class JEnum : public JObject
+{
+public:
+    using JniType = jobject;
+
+    /// @brief create empty JNI object wrapper
+    JEnum() = default;
+    /// @brief wrap around an existing JNI enum object
+    JEnum(const jobject& initObject)
+        : JObject(initObject)
+    {}
+    /// @brief wrap around the Java constant of a C++ enum value
+    JEnum(TEnum value)
+        : JObject(JEnumMapping<TEnum>::toJni(value))
+    {}
+
+    inline TEnum getValue() const
+    {
+        return JEnumMapping<TEnum>::fromJni(jniObject);
+    }
+
+    inline TEnum getValueJni(JEnv& env) const
+    {
+        return JEnumMapping<TEnum>::fromJni(env, jniObject);
+    }
+
+    static constexpr const char* getClassName()
+    {
+        return JEnumTraits<TEnum>::getClassName();
+    }
+};
+
+}
+
+#endif // __GUSC_JENUM_HPP
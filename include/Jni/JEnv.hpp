@@ -7,6 +7,8 @@ namespace gusc::Jni
 {
 
 class JClass;
+template<typename T>
+class JResult;
 
 class JEnv
 {
@@ -32,6 +34,9 @@ public:
 
     JClass getClass(const char* classPath);
 
+    /// @brief Non-throwing variant of getClass (see JResult)
+    JResult<JClass> tryGetClass(const char* classPath);
+
     JClass getObjectClass(jobject jniObject);
 
     inline operator JNIEnv*()
@@ -45,6 +50,10 @@ public:
     }
 
     static void checkException(JEnv& env);
+    /// @brief Debug check before invoke*Jni calls that no Java exception is pending inside a JExceptionBatch (no-op with NDEBUG)
+    static void checkBatch(JEnv& env);
+    /// @brief Exception check after invoke*Jni calls, deferred while a JExceptionBatch is active
+    static void checkInvokeException(JEnv& env);
 
 private:
     struct JEnvLifetimeHandle
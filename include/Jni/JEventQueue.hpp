@@ -0,0 +1,405 @@
+#ifndef __GUSC_JEVENTQUEUE_HPP
+#define __GUSC_JEVENTQUEUE_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+/// @brief Event posted to a JEventQueue
+template<typename TPayload>
+struct JEvent
+{
+    std::uint32_t type { 0 };
+    /// @brief steady_clock time of the post in nanoseconds
+    std::int64_t postTime { 0 };
+    TPayload payload {};
+};
+
+/// @brief Bounded lock-free multi-producer single-consumer queue of trivially copyable events
+/// All slots are allocated up front, producers never allocate, lock or block - when the queue is full the event is
+/// dropped. With a single producer tryPush is wait-free.
+/// @note Capacity must be a power of two
+template<typename TPayload, std::size_t Capacity = 1024>
+class JEventQueue final
+{
+public:
+    static_assert(std::is_trivially_copyable_v<TPayload>, "JEventQueue payload must be trivially copyable");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "JEventQueue capacity must be a power of two");
+
+    using Event = JEvent<TPayload>;
+
+    JEventQueue()
+        : slots(std::make_unique<Slot[]>(Capacity))
+    {
+        for (std::size_t i = 0; i < Capacity; ++i)
+        {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+    JEventQueue(const JEventQueue&) = delete;
+    JEventQueue& operator=(const JEventQueue&) = delete;
+    JEventQueue(JEventQueue&&) = delete;
+    JEventQueue& operator=(JEventQueue&&) = delete;
+
+    /// @brief Push an event from any thread, returns false if the queue is full
+    bool tryPush(const Event& event) noexcept
+    {
+        auto pos = tail.load(std::memory_order_relaxed);
+        Slot* slot { nullptr };
+        while (true)
+        {
+            slot = &slots[pos & mask];
+            const auto sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Slot still holds an event from the previous lap
+                return false;
+            }
+            else
+            {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+        slot->event = event;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Pop the oldest event, must only be called from the consumer thread
+    bool tryPop(Event& event) noexcept
+    {
+        const auto pos = head.load(std::memory_order_relaxed);
+        auto& slot = slots[pos & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+        {
+            return false;
+        }
+        event = slot.event;
+        slot.sequence.store(pos + Capacity, std::memory_order_release);
+        head.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// @brief Approximate number of queued events
+    inline std::size_t size() const noexcept
+    {
+        const auto popped = head.load(std::memory_order_relaxed);
+        const auto pushed = tail.load(std::memory_order_relaxed);
+        return pushed > popped ? pushed - popped : 0;
+    }
+
+    static constexpr std::size_t capacity() noexcept
+    {
+        return Capacity;
+    }
+
+private:
+    static constexpr std::size_t mask { Capacity - 1 };
+    // Producer and consumer positions live on separate cache lines
+    static constexpr std::size_t cacheLine { 64 };
+
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence { 0 };
+        Event event;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    alignas(cacheLine) std::atomic<std::size_t> tail { 0 };
+    // Only written by the consumer
+    alignas(cacheLine) std::atomic<std::size_t> head { 0 };
+};
+
+/// @brief Counters of a JEventDispatcher
+struct JEventStats
+{
+    std::uint64_t posted { 0 };
+    std::uint64_t delivered { 0 };
+    /// @brief Events rejected because the queue was full (or the type was unknown) and events that couldn't be
+    /// delivered because the local reference frame of the handler couldn't be allocated
+    std::uint64_t dropped { 0 };
+    /// @brief Events replaced by a newer event of the same type before they were delivered
+    std::uint64_t coalesced { 0 };
+    /// @brief Time from post to the start of the handler
+    std::chrono::nanoseconds maxLatency { 0 };
+    std::chrono::nanoseconds averageLatency { 0 };
+};
+
+/// @brief Sends events from real-time threads to Java
+/// post() never attaches to the JVM, allocates or locks, so it can be called from an audio render callback.
+/// A dedicated daemon thread stays attached to the JVM, drains the queue and calls the handler registered for the event
+/// type (usually a pre-resolved JMethod). Events of a coalescing type that pile up between two dispatches (more of them
+/// the further the dispatcher falls behind) are collapsed to the latest one - meter levels only need the newest value,
+/// state changes can opt out of coalescing.
+/// @code
+///   enum EventType : std::uint32_t { Level, State, EventTypeCount };
+///   struct Payload { jint channel; jfloat value; };
+///   JEventDispatcher<Payload> events { EventTypeCount, "MeterEvents" };
+///   events.on(Level, [&](JEnv& env, const Payload& p) { onLevel.invokeJni(env, listener, p.channel, p.value); });
+///   events.on(State, [&](JEnv& env, const Payload& p) { onState.invokeJni(env, listener, p.channel); }, false);
+///   events.start();
+///   // audio thread
+///   events.post(Level, { 0, peak });
+template<typename TPayload, std::size_t Capacity = 1024>
+class JEventDispatcher final
+{
+public:
+    using Event = JEvent<TPayload>;
+    using Handler = std::function<void(JEnv&, const TPayload&)>;
+
+    /// @param typeCount - number of event types, types are 0 ... typeCount - 1
+    /// @param initName - Java thread name of the dispatcher
+    /// @param interval - sleep time of the dispatcher when the queue is empty (producers never wake it up)
+    explicit JEventDispatcher(std::size_t typeCount, std::string initName = "JniEvents", std::chrono::microseconds interval = std::chrono::microseconds(1000))
+        : name(std::move(initName))
+        , pollInterval(interval)
+        , handlers(typeCount)
+        , batch(Capacity)
+        , skip(Capacity)
+        , lastSeen(typeCount, 0)
+    {}
+    JEventDispatcher(const JEventDispatcher&) = delete;
+    JEventDispatcher& operator=(const JEventDispatcher&) = delete;
+    JEventDispatcher(JEventDispatcher&&) = delete;
+    JEventDispatcher& operator=(JEventDispatcher&&) = delete;
+    /// @brief Deliver the queued events and stop the dispatcher
+    ~JEventDispatcher()
+    {
+        stop();
+    }
+
+    /// @brief Register the handler of an event type, must be called before start()
+    /// @param coalesce - deliver only the latest event of this type from each drained batch
+    void on(std::uint32_t type, Handler handler, bool coalesce = true)
+    {
+        if (thread.joinable())
+        {
+            throw std::runtime_error("Event handlers can't be changed while the dispatcher is running");
+        }
+        if (type >= handlers.size())
+        {
+            throw std::out_of_range("Event type " + std::to_string(type) + " is out of range");
+        }
+        handlers[type] = { std::move(handler), coalesce };
+    }
+
+    /// @brief Start the dispatcher thread and attach it to the JVM
+    void start()
+    {
+        if (thread.joinable())
+        {
+            return;
+        }
+        if (!JVM::getVm())
+        {
+            throw std::runtime_error("JVM is not initialized");
+        }
+        running.store(true, std::memory_order_relaxed);
+        thread = std::thread(&JEventDispatcher::run, this);
+    }
+
+    /// @brief Deliver the queued events, then detach and join the dispatcher thread
+    void stop()
+    {
+        if (!thread.joinable())
+        {
+            return;
+        }
+        running.store(false, std::memory_order_relaxed);
+        thread.join();
+    }
+
+    inline bool isRunning() const noexcept
+    {
+        return thread.joinable();
+    }
+
+    /// @brief Queue an event, safe to call from real-time threads
+    /// @return false if the event was dropped
+    bool post(std::uint32_t type, const TPayload& payload) noexcept
+    {
+        const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+        if (type >= handlers.size() || !queue.tryPush(Event { type, now, payload }))
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        posted.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    JEventStats getStats() const noexcept
+    {
+        JEventStats stats;
+        stats.posted = posted.load(std::memory_order_relaxed);
+        stats.delivered = delivered.load(std::memory_order_relaxed);
+        stats.dropped = dropped.load(std::memory_order_relaxed);
+        stats.coalesced = coalesced.load(std::memory_order_relaxed);
+        stats.maxLatency = std::chrono::nanoseconds { maxLatency.load(std::memory_order_relaxed) };
+        if (stats.delivered)
+        {
+            stats.averageLatency = std::chrono::nanoseconds { totalLatency.load(std::memory_order_relaxed) / static_cast<std::int64_t>(stats.delivered) };
+        }
+        return stats;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr jint localFrameSize { 16 };
+
+    struct TypeHandler
+    {
+        Handler handler;
+        bool coalesce { true };
+    };
+
+    std::string name;
+    std::chrono::microseconds pollInterval;
+    std::vector<TypeHandler> handlers;
+    JEventQueue<TPayload, Capacity> queue;
+    std::thread thread;
+    std::atomic<bool> running { false };
+    // Dispatcher thread buffers, allocated up front
+    std::vector<Event> batch;
+    std::vector<bool> skip;
+    std::vector<std::uint64_t> lastSeen;
+    std::uint64_t generation { 0 };
+    std::atomic<std::uint64_t> posted { 0 };
+    std::atomic<std::uint64_t> delivered { 0 };
+    std::atomic<std::uint64_t> dropped { 0 };
+    std::atomic<std::uint64_t> coalesced { 0 };
+    std::atomic<std::int64_t> maxLatency { 0 };
+    std::atomic<std::int64_t> totalLatency { 0 };
+
+    void run()
+    {
+        auto vm = JVM::getVm();
+        JNIEnv* jniEnv { nullptr };
+        JavaVMAttachArgs args { JNI_VERSION_1_6, const_cast<char*>(name.c_str()), nullptr };
+        if (vm->AttachCurrentThreadAsDaemon(&jniEnv, &args) != JNI_OK)
+        {
+            return;
+        }
+        {
+            JEnvScope scope { jniEnv };
+            JEnv env { jniEnv };
+            while (true)
+            {
+                // Read the flag before draining so that events posted before stop() are delivered
+                const auto keepRunning = running.load(std::memory_order_relaxed);
+                if (!dispatch(env) && !keepRunning)
+                {
+                    break;
+                }
+                if (queue.size() == 0)
+                {
+                    std::this_thread::sleep_for(pollInterval);
+                }
+            }
+        }
+        vm->DetachCurrentThread();
+    }
+
+    /// @brief Drain the queue and deliver one batch, returns false if there was nothing to deliver
+    bool dispatch(JEnv& env)
+    {
+        std::size_t count { 0 };
+        while (count < batch.size() && queue.tryPop(batch[count]))
+        {
+            ++count;
+        }
+        if (!count)
+        {
+            return false;
+        }
+        // Walk back from the newest event, older events of a coalescing type are skipped
+        ++generation;
+        for (auto i = count; i-- > 0;)
+        {
+            const auto type = batch[i].type;
+            skip[i] = handlers[type].coalesce && lastSeen[type] == generation;
+            lastSeen[type] = generation;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (skip[i])
+            {
+                coalesced.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            const auto& event = batch[i];
+            const auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+            if (!deliver(env, event))
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            const auto latency = now - event.postTime;
+            if (latency > maxLatency.load(std::memory_order_relaxed))
+            {
+                maxLatency.store(latency, std::memory_order_relaxed);
+            }
+            totalLatency.fetch_add(latency, std::memory_order_relaxed);
+            delivered.fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /// @brief Call the handler of the event, returns false if the event had to be dropped
+    bool deliver(JEnv& env, const Event& event) noexcept
+    {
+        const auto& handler = handlers[event.type].handler;
+        if (!handler)
+        {
+            return true;
+        }
+        if (env->PushLocalFrame(localFrameSize) != JNI_OK)
+        {
+            // OutOfMemoryError is pending, the handler must not call into Java with it
+            env->ExceptionClear();
+            return false;
+        }
+        try
+        {
+            handler(env, event.payload);
+        }
+        catch (...)
+        {
+            // Handler errors must not stop the delivery of other events
+        }
+        if (env->ExceptionCheck())
+        {
+            env->ExceptionClear();
+        }
+        env->PopLocalFrame(nullptr);
+        return true;
+    }
+};
+
+}
+
+#endif // __GUSC_JEVENTQUEUE_HPP
@@ -0,0 +1,614 @@
+#ifndef __GUSC_JEXCEPTION_HPP
+#define __GUSC_JEXCEPTION_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JObject.hpp"
+#include "JClass.hpp"
+#include "JString.hpp"
+#include <exception>
+#include <memory>
+#include <new>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+namespace Private
+{
+
+/// @brief Throwable class and method IDs, resolved once and kept for the lifetime of the process
+struct ThrowableInfo
+{
+    jclass throwableClass { nullptr };
+    jclass classClass { nullptr };
+    jclass stackTraceElementClass { nullptr };
+    jmethodID getMessage { nullptr };
+    jmethodID getStackTrace { nullptr };
+    jmethodID toString { nullptr };
+    jmethodID getName { nullptr };
+    jmethodID elementToString { nullptr };
+
+    static const ThrowableInfo& get(JNIEnv* env)
+    {
+        static const ThrowableInfo info { env };
+        return info;
+    }
+
+private:
+    ThrowableInfo(JNIEnv* env)
+    {
+        throwableClass = getGlobalClass(env, "java/lang/Throwable");
+        classClass = getGlobalClass(env, "java/lang/Class");
+        stackTraceElementClass = getGlobalClass(env, "java/lang/StackTraceElement");
+        getMessage = env->GetMethodID(throwableClass, "getMessage", "()Ljava/lang/String;");
+        getStackTrace = env->GetMethodID(throwableClass, "getStackTrace", "()[Ljava/lang/StackTraceElement;");
+        toString = env->GetMethodID(throwableClass, "toString", "()Ljava/lang/String;");
+        getName = env->GetMethodID(classClass, "getName", "()Ljava/lang/String;");
+        elementToString = env->GetMethodID(stackTraceElementClass, "toString", "()Ljava/lang/String;");
+    }
+
+    static jclass getGlobalClass(JNIEnv* env, const char* classPath)
+    {
+        auto cls = env->FindClass(classPath);
+        auto global = static_cast<jclass>(env->NewGlobalRef(cls));
+        env->DeleteLocalRef(cls);
+        return global;
+    }
+};
+
+/// @brief Convert a Java string returned by a throwable method, any secondary exception is swallowed
+inline std::string fromThrowableString(JNIEnv* env, jobject str)
+{
+    if (env->ExceptionCheck() == JNI_TRUE)
+    {
+        env->ExceptionClear();
+        return {};
+    }
+    if (!str)
+    {
+        return {};
+    }
+    std::string res;
+    auto jstr = static_cast<jstring>(str);
+    if (auto chars = env->GetStringUTFChars(jstr, nullptr))
+    {
+        res.assign(chars, chars + env->GetStringUTFLength(jstr));
+        env->ReleaseStringUTFChars(jstr, chars);
+    }
+    env->DeleteLocalRef(str);
+    return res;
+}
+
+}
+
+/// @brief C++ exception that carries a Java throwable
+/// The throwable is kept as a global reference, message, class name and stack trace
+/// are read from Java only when they are asked for.
+class JException : public std::runtime_error
+{
+public:
+    /// @brief take over a local reference of a throwable
+    JException(JEnv& env, jthrowable initThrowable)
+        : std::runtime_error("JNI Exception occured")
+        , state(std::make_shared<State>())
+    {
+        if (initThrowable)
+        {
+            state->throwable = env->NewGlobalRef(initThrowable);
+            env->DeleteLocalRef(initThrowable);
+        }
+    }
+
+    /// @brief "JNI Exception occured: " followed by the Java exception message
+    const char* what() const noexcept override
+    {
+        try
+        {
+            std::call_once(state->whatOnce, [this]() {
+                state->what = std::string("JNI Exception occured: ") + getMessage();
+            });
+            return state->what.c_str();
+        }
+        catch (...)
+        {
+            return std::runtime_error::what();
+        }
+    }
+
+    /// @brief Java exception message (Throwable.getMessage)
+    const std::string& getMessage() const
+    {
+        std::call_once(state->messageOnce, [this]() {
+            auto env = JVM::getEnv();
+            const auto& info = Private::ThrowableInfo::get(env);
+            state->message = Private::fromThrowableString(env, env->CallObjectMethod(state->throwable, info.getMessage));
+        });
+        return state->message;
+    }
+
+    /// @brief Fully qualified name of the Java exception class (i.e. java.lang.IllegalStateException)
+    std::string getClassName() const
+    {
+        auto env = JVM::getEnv();
+        const auto& info = Private::ThrowableInfo::get(env);
+        auto cls = env->GetObjectClass(state->throwable);
+        auto name = Private::fromThrowableString(env, env->CallObjectMethod(cls, info.getName));
+        env->DeleteLocalRef(cls);
+        return name;
+    }
+
+    /// @brief Java stack trace in the same format as Throwable.printStackTrace (without causes)
+    std::string getStackTrace() const
+    {
+        auto env = JVM::getEnv();
+        const auto& info = Private::ThrowableInfo::get(env);
+        auto res = Private::fromThrowableString(env, env->CallObjectMethod(state->throwable, info.toString));
+        auto elements = static_cast<jobjectArray>(env->CallObjectMethod(state->throwable, info.getStackTrace));
+        if (env->ExceptionCheck() == JNI_TRUE)
+        {
+            env->ExceptionClear();
+            return res;
+        }
+        if (elements)
+        {
+            const auto count = env->GetArrayLength(elements);
+            for (jsize i = 0; i < count; ++i)
+            {
+                auto element = env->GetObjectArrayElement(elements, i);
+                res += "\n\tat " + Private::fromThrowableString(env, env->CallObjectMethod(element, info.elementToString));
+                env->DeleteLocalRef(element);
+            }
+            env->DeleteLocalRef(elements);
+        }
+        return res;
+    }
+
+    /// @brief Access the Java throwable (global reference owned by this exception)
+    inline jthrowable getThrowable() const noexcept
+    {
+        return static_cast<jthrowable>(state->throwable);
+    }
+
+    /// @brief Throw the Java throwable again in Java
+    inline void rethrowJni(JEnv& env) const noexcept
+    {
+        env->Throw(getThrowable());
+    }
+
+private:
+    struct State
+    {
+        /// @brief Release the throwable if the current thread is attached, otherwise it is leaked (an exception
+        /// stored in an exception_ptr or a std::future can be destroyed on any thread)
+        ~State()
+        {
+            if (!throwable)
+            {
+                return;
+            }
+            if (auto env = JVM::getAttachedEnv())
+            {
+                env->DeleteGlobalRef(throwable);
+            }
+        }
+
+        jobject throwable { nullptr };
+        std::once_flag messageOnce;
+        std::string message;
+        std::once_flag whatOnce;
+        std::string what;
+    };
+
+    // Shared, so that copying the exception while it's thrown is cheap
+    std::shared_ptr<State> state;
+};
+
+/// @brief java.lang.RuntimeException
+class JRuntimeException : public JException
+{
+public:
+    using JException::JException;
+};
+
+/// @brief java.lang.IllegalArgumentException
+class JIllegalArgumentException : public JRuntimeException
+{
+public:
+    using JRuntimeException::JRuntimeException;
+};
+
+/// @brief java.lang.IllegalStateException
+class JIllegalStateException : public JRuntimeException
+{
+public:
+    using JRuntimeException::JRuntimeException;
+};
+
+/// @brief java.lang.NullPointerException
+class JNullPointerException : public JRuntimeException
+{
+public:
+    using JRuntimeException::JRuntimeException;
+};
+
+/// @brief java.lang.IndexOutOfBoundsException
+class JIndexOutOfBoundsException : public JRuntimeException
+{
+public:
+    using JRuntimeException::JRuntimeException;
+};
+
+/// @brief java.lang.UnsupportedOperationException
+class JUnsupportedOperationException : public JRuntimeException
+{
+public:
+    using JRuntimeException::JRuntimeException;
+};
+
+/// @brief java.io.IOException
+class JIOException : public JException
+{
+public:
+    using JException::JException;
+};
+
+/// @brief java.lang.Error
+class JError : public JException
+{
+public:
+    using JException::JException;
+};
+
+/// @brief Registry that maps Java exception classes to C++ exception types and back
+/// Java classes are matched with IsInstanceOf, subclasses are always tried before their super classes,
+/// so the most specific registered C++ type is thrown. Unknown exceptions are thrown as JException.
+/// C++ exceptions escaping native methods are matched in reverse registration order (register base types first)
+/// and thrown in Java with ThrowNew, all Java classes are resolved once.
+/// @code
+///   // JNI_OnLoad
+///   JExceptionRegistry::registerException<MyRetryableException>("my/package/RetryableException");
+///   ...
+///   try
+///   {
+///       obj.invokeMethod<void>("send");
+///   }
+///   catch (const MyRetryableException&)
+///   {
+///       // retry without ever reading the message
+///   }
+class JExceptionRegistry final
+{
+public:
+    JExceptionRegistry() = delete;
+
+    /// @brief Register a C++ exception type (must be constructible from JEnv& and jthrowable) for a Java exception class
+    template<typename TException>
+    static void registerException(const char* classPath)
+    {
+        static_assert(std::is_base_of_v<JException, TException>, "TException must be derived from JException");
+        auto env = JVM::getEnv();
+        registerExceptionJni(env, env.getClass(classPath), [](JEnv& env, jthrowable throwable) {
+            throw TException(env, throwable);
+        });
+    }
+
+    /// @brief Register a Java exception class for a C++ exception type escaping native methods
+    template<typename TException>
+    static void registerNativeException(const char* classPath)
+    {
+        auto env = JVM::getEnv();
+        auto cls = env.getClass(classPath);
+        auto& registry = getRegistry(env);
+        std::unique_lock lock { registry.mutex };
+        insertNative<TException>(env, registry, cls);
+    }
+
+    /// @brief Throw the exception that is currently being handled in Java
+    /// Must be called from a catch block, JException is thrown with its original throwable.
+    /// @code
+    ///   catch (...)
+    ///   {
+    ///       JExceptionRegistry::throwJni(env);
+    ///   }
+    static void throwJni(JEnv& env) noexcept
+    {
+        const auto exception = std::current_exception();
+        if (!exception)
+        {
+            return;
+        }
+        try
+        {
+            std::rethrow_exception(exception);
+        }
+        catch (const JException& e)
+        {
+            e.rethrowJni(env);
+            return;
+        }
+        catch (...)
+        {}
+        try
+        {
+            auto& registry = getRegistry(env);
+            std::shared_lock lock { registry.mutex };
+            for (auto it = registry.nativeEntries.rbegin(); it != registry.nativeEntries.rend(); ++it)
+            {
+                if (it->thrower(env, it->cls, exception))
+                {
+                    return;
+                }
+            }
+            env->ThrowNew(registry.defaultNativeClass, "Unknown native exception");
+        }
+        catch (...)
+        {}
+    }
+
+    /// @brief Translate a pending Java exception into a C++ exception
+    static void checkException(JEnv& env)
+    {
+        if (env->ExceptionCheck() == JNI_TRUE)
+        {
+            auto throwable = env->ExceptionOccurred();
+            env->ExceptionClear();
+            throwException(env, throwable);
+        }
+    }
+
+    /// @brief Throw the registered C++ exception for a throwable (takes over the local reference)
+    [[noreturn]] static void throwException(JEnv& env, jthrowable throwable)
+    {
+        auto& registry = getRegistry(env);
+        std::shared_lock lock { registry.mutex };
+        for (const auto& entry : registry.entries)
+        {
+            if (env->IsInstanceOf(throwable, entry.cls) == JNI_TRUE)
+            {
+                const auto thrower = entry.thrower;
+                lock.unlock();
+                thrower(env, throwable);
+            }
+        }
+        lock.unlock();
+        throw JException(env, throwable);
+    }
+
+private:
+    using Thrower = void(*)(JEnv&, jthrowable);
+    using NativeThrower = bool(*)(JEnv&, jclass, const std::exception_ptr&);
+
+    struct Entry
+    {
+        jclass cls { nullptr };
+        Thrower thrower { nullptr };
+    };
+
+    struct NativeEntry
+    {
+        jclass cls { nullptr };
+        NativeThrower thrower { nullptr };
+    };
+
+    struct Registry
+    {
+        std::shared_mutex mutex;
+        std::vector<Entry> entries;
+        std::vector<NativeEntry> nativeEntries;
+        jclass defaultNativeClass { nullptr };
+    };
+
+    static void registerExceptionJni(JEnv& env, const JClass& cls, Thrower thrower)
+    {
+        auto& registry = getRegistry(env);
+        std::unique_lock lock { registry.mutex };
+        insert(env, registry, cls, thrower);
+    }
+
+    static void insert(JEnv& env, Registry& registry, jclass cls, Thrower thrower)
+    {
+        auto it = registry.entries.begin();
+        for (; it != registry.entries.end(); ++it)
+        {
+            if (env->IsSameObject(it->cls, cls) == JNI_TRUE)
+            {
+                it->thrower = thrower;
+                return;
+            }
+            // Keep subclasses in front of their super classes
+            if (env->IsAssignableFrom(cls, it->cls) == JNI_TRUE)
+            {
+                break;
+            }
+        }
+        registry.entries.insert(it, Entry { static_cast<jclass>(env->NewGlobalRef(cls)), thrower });
+    }
+
+    template<typename TException>
+    static void insertBuiltIn(JEnv& env, Registry& registry, const char* classPath)
+    {
+        auto cls = env->FindClass(classPath);
+        if (!cls)
+        {
+            env->ExceptionClear();
+            return;
+        }
+        insert(env, registry, cls, [](JEnv& env, jthrowable throwable) {
+            throw TException(env, throwable);
+        });
+        env->DeleteLocalRef(cls);
+    }
+
+    template<typename TException>
+    static void insertNative(JEnv& env, Registry& registry, jclass cls)
+    {
+        const NativeThrower thrower = [](JEnv& env, jclass cls, const std::exception_ptr& exception) {
+            try
+            {
+                std::rethrow_exception(exception);
+            }
+            catch (const TException& e)
+            {
+                env->ThrowNew(cls, e.what());
+                return true;
+            }
+            catch (...)
+            {}
+            return false;
+        };
+        for (auto& entry : registry.nativeEntries)
+        {
+            if (entry.thrower == thrower)
+            {
+                env->DeleteGlobalRef(entry.cls);
+                entry.cls = static_cast<jclass>(env->NewGlobalRef(cls));
+                return;
+            }
+        }
+        registry.nativeEntries.push_back(NativeEntry { static_cast<jclass>(env->NewGlobalRef(cls)), thrower });
+    }
+
+    template<typename TException>
+    static void insertNativeBuiltIn(JEnv& env, Registry& registry, const char* classPath)
+    {
+        auto cls = env->FindClass(classPath);
+        if (!cls)
+        {
+            env->ExceptionClear();
+            return;
+        }
+        insertNative<TException>(env, registry, cls);
+        env->DeleteLocalRef(cls);
+    }
+
+    static Registry& getRegistry(JEnv& env)
+    {
+        // Leaked intentionally - the registry holds global references and is used until the very end of the process
+        static Registry* registry = [&env]() {
+            auto res = new Registry();
+            insertBuiltIn<JRuntimeException>(env, *res, "java/lang/RuntimeException");
+            insertBuiltIn<JIllegalArgumentException>(env, *res, "java/lang/IllegalArgumentException");
+            insertBuiltIn<JIllegalStateException>(env, *res, "java/lang/IllegalStateException");
+            insertBuiltIn<JNullPointerException>(env, *res, "java/lang/NullPointerException");
+            insertBuiltIn<JIndexOutOfBoundsException>(env, *res, "java/lang/IndexOutOfBoundsException");
+            insertBuiltIn<JUnsupportedOperationException>(env, *res, "java/lang/UnsupportedOperationException");
+            insertBuiltIn<JIOException>(env, *res, "java/io/IOException");
+            insertBuiltIn<JError>(env, *res, "java/lang/Error");
+            insertNativeBuiltIn<std::exception>(env, *res, "java/lang/RuntimeException");
+            insertNativeBuiltIn<std::logic_error>(env, *res, "java/lang/IllegalStateException");
+            insertNativeBuiltIn<std::invalid_argument>(env, *res, "java/lang/IllegalArgumentException");
+            insertNativeBuiltIn<std::out_of_range>(env, *res, "java/lang/IndexOutOfBoundsException");
+            insertNativeBuiltIn<std::bad_alloc>(env, *res, "java/lang/OutOfMemoryError");
+            res->defaultNativeClass = res->nativeEntries.front().cls;
+            return res;
+        }();
+        return *registry;
+    }
+};
+
+/// @brief Scope that skips the exception check after each invoke*Jni call and checks once at scope exit
+/// JNI forbids calling into Java while an exception is pending, so only chain calls that are not expected to
+/// throw (i.e. setters or event pushes) - a batch is not a way to handle expected exceptions. In release builds
+/// the calls are not checked at all and a call made after an exception is undefined behaviour, debug builds check
+/// before every invoke*Jni call inside the scope and throw std::logic_error on such a call. The pending exception
+/// is translated and thrown when the scope exits (unless the stack is already being unwound by another exception)
+/// or when check() is called. Other library calls keep checking exceptions immediately.
+/// @code
+///   {
+///       JExceptionBatch batch { env };
+///       for (const auto& event : events)
+///       {
+///           queue.invokeMethodJni<void>(env, pushId, event.type, event.value);
+///       }
+///   } // throws the Java exception here
+class JExceptionBatch final
+{
+public:
+    explicit JExceptionBatch(JEnv& initEnv)
+        : env(initEnv)
+        , previous(current)
+        , uncaughtExceptions(std::uncaught_exceptions())
+    {
+        if (env->ExceptionCheck() == JNI_TRUE)
+        {
+            throw std::logic_error("JExceptionBatch started with a pending Java exception");
+        }
+        current = this;
+    }
+    JExceptionBatch(const JExceptionBatch&) = delete;
+    JExceptionBatch& operator=(const JExceptionBatch&) = delete;
+    JExceptionBatch(JExceptionBatch&&) = delete;
+    JExceptionBatch& operator=(JExceptionBatch&&) = delete;
+    ~JExceptionBatch() noexcept(false)
+    {
+        current = previous;
+        if (std::uncaught_exceptions() > uncaughtExceptions)
+        {
+            // Already unwinding - drop the Java exception so that the env is usable by the handlers
+            env->ExceptionClear();
+            return;
+        }
+        check();
+    }
+
+    /// @brief Translate the pending Java exception into a C++ exception
+    void check()
+    {
+        JExceptionRegistry::checkException(env);
+    }
+
+    /// @brief Check if exception checks are currently deferred on this thread
+    static inline bool isActive() noexcept
+    {
+        return current != nullptr;
+    }
+
+private:
+    friend class JEnv;
+
+    inline static thread_local JExceptionBatch* current { nullptr };
+
+    JEnv env;
+    JExceptionBatch* previous { nullptr };
+    int uncaughtExceptions { 0 };
+};
+
+inline void JEnv::checkException(JEnv& env)
+{
+    JExceptionRegistry::checkException(env);
+}
+
+#if defined(NDEBUG)
+inline void JEnv::checkBatch(JEnv& /*env*/)
+{
+}
+#else
+inline void JEnv::checkBatch(JEnv& env)
+{
+    if (JExceptionBatch::current && env->ExceptionCheck() == JNI_TRUE)
+    {
+        throw std::logic_error("invoke*Jni called with a pending Java exception inside JExceptionBatch");
+    }
+}
+#endif
+
+inline void JEnv::checkInvokeException(JEnv& env)
+{
+    if (JExceptionBatch::current)
+    {
+        // Checked once when the batch exits
+        return;
+    }
+    JExceptionRegistry::checkException(env);
+}
+
+}
+
+#endif // __GUSC_JEXCEPTION_HPP
@@ -0,0 +1,168 @@
+#ifndef __GUSC_JFIELD_HPP
+#define __GUSC_JFIELD_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JClass.hpp"
+#include "private/signature.hpp"
+#include "private/field.hpp"
+#include <string>
+
+namespace gusc::Jni
+{
+
+/// @brief Instance field handle that is resolved once and can be used with any object of the class
+/// @code
+///   JField<jlong> nativePtr { cls, "nativePtr" };
+///   auto ptr = nativePtr.get(obj);
+template<typename T>
+class JField final
+{
+public:
+    /// @brief create an unresolved field handle
+    JField() = default;
+    /// @brief resolve field by name (the signature is automatically generated at compile time from T type)
+    JField(const JClass& initClass, const std::string& name)
+    {
+        resolve(initClass, name);
+    }
+    JField(const JField&) = default;
+    JField& operator=(const JField&) = default;
+    JField(JField&&) = default;
+    JField& operator=(JField&&) = default;
+    ~JField() = default;
+
+    inline void resolve(const JClass& initClass, const std::string& name)
+    {
+        fieldId = initClass.getFieldIdSign(name, signature.str);
+        cls = initClass.createGlobalRef();
+    }
+
+    inline operator bool() const noexcept
+    {
+        return fieldId != nullptr;
+    }
+
+    inline T get(jobject obj) const
+    {
+        auto env = JVM::getEnv();
+        return getJni(env, obj);
+    }
+
+    inline T getJni(JEnv& env, jobject obj) const
+    {
+        return Private::getFieldValue<T>(env, obj, fieldId);
+    }
+
+    inline void set(jobject obj, const T& value) const
+    {
+        auto env = JVM::getEnv();
+        setJni(env, obj, value);
+    }
+
+    inline void setJni(JEnv& env, jobject obj, const T& value) const noexcept
+    {
+        Private::setFieldValue<T>(env, obj, fieldId, value);
+    }
+
+    inline jfieldID getFieldId() const noexcept
+    {
+        return fieldId;
+    }
+
+    inline const JClass& getClass() const noexcept
+    {
+        return cls;
+    }
+
+    static constexpr const char* getSignature()
+    {
+        return signature.str;
+    }
+
+private:
+    static constexpr auto signature = Private::getJTypeSignature<T>();
+
+    JClass cls { nullptr };
+    jfieldID fieldId { nullptr };
+};
+
+/// @brief Static field handle that is resolved once
+/// @code
+///   JStaticField<jint> counter { cls, "counter" };
+///   counter.set(counter.get() + 1);
+template<typename T>
+class JStaticField final
+{
+public:
+    /// @brief create an unresolved field handle
+    JStaticField() = default;
+    /// @brief resolve static field by name (the signature is automatically generated at compile time from T type)
+    JStaticField(const JClass& initClass, const std::string& name)
+    {
+        resolve(initClass, name);
+    }
+    JStaticField(const JStaticField&) = default;
+    JStaticField& operator=(const JStaticField&) = default;
+    JStaticField(JStaticField&&) = default;
+    JStaticField& operator=(JStaticField&&) = default;
+    ~JStaticField() = default;
+
+    inline void resolve(const JClass& initClass, const std::string& name)
+    {
+        fieldId = initClass.getStaticFieldIdSign(name, signature.str);
+        cls = initClass.createGlobalRef();
+    }
+
+    inline operator bool() const noexcept
+    {
+        return fieldId != nullptr;
+    }
+
+    inline T get() const
+    {
+        auto env = JVM::getEnv();
+        return getJni(env);
+    }
+
+    inline T getJni(JEnv& env) const
+    {
+        return Private::getStaticFieldValue<T>(env, cls, fieldId);
+    }
+
+    inline void set(const T& value) const
+    {
+        auto env = JVM::getEnv();
+        setJni(env, value);
+    }
+
+    inline void setJni(JEnv& env, const T& value) const noexcept
+    {
+        Private::setStaticFieldValue<T>(env, cls, fieldId, value);
+    }
+
+    inline jfieldID getFieldId() const noexcept
+    {
+        return fieldId;
+    }
+
+    inline const JClass& getClass() const noexcept
+    {
+        return cls;
+    }
+
+    static constexpr const char* getSignature()
+    {
+        return signature.str;
+    }
+
+private:
+    static constexpr auto signature = Private::getJTypeSignature<T>();
+
+    JClass cls { nullptr };
+    jfieldID fieldId { nullptr };
+};
+
+}
+
+#endif // __GUSC_JFIELD_HPP
@@ -0,0 +1,222 @@
+#ifndef __GUSC_JMANIFEST_HPP
+#define __GUSC_JMANIFEST_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JClass.hpp"
+#include "JMethod.hpp"
+#include "JField.hpp"
+#include "JConstant.hpp"
+#include "JEnum.hpp"
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+/// @brief Declarative list of classes and members that are resolved in one batch at startup, so that the
+/// first call of a member does not pay for FindClass and GetMethodID
+/// @code
+///   constexpr const char my_package_Filter[] = "my.package.Filter";
+///   JMethod<void(jfloat)> setGain;
+///   JField<jlong> nativePtr;
+///   JManifest::getDefault()
+///       .addClass<my_package_Filter>()
+///       .add<my_package_Filter>(setGain, "setGain")
+///       .add<my_package_Filter>(nativePtr, "nativePtr");
+///   // JNI_OnLoad (Jni.cpp) resolves the default manifest
+class JManifest final
+{
+public:
+    /// @brief Result of resolving a single manifest entry
+    struct Entry
+    {
+        std::string kind;
+        std::string className;
+        std::string name;
+        std::chrono::nanoseconds duration { 0 };
+        std::string error;
+    };
+
+    /// @brief Result of resolving the whole manifest
+    struct Report
+    {
+        std::vector<Entry> entries;
+        std::chrono::nanoseconds duration { 0 };
+
+        inline bool hasErrors() const noexcept
+        {
+            for (const auto& entry : entries)
+            {
+                if (!entry.error.empty())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /// @brief All errors, one line per entry
+        std::string getErrors() const
+        {
+            std::string res;
+            for (const auto& entry : entries)
+            {
+                if (!entry.error.empty())
+                {
+                    res += entry.kind + " " + entry.className + (entry.name.empty() ? "" : "." + entry.name) + ": " + entry.error + "\n";
+                }
+            }
+            return res;
+        }
+    };
+
+    /// @brief Manifest that is resolved automatically in JNI_OnLoad when Jni_AutoInit is enabled
+    static JManifest& getDefault()
+    {
+        static JManifest manifest;
+        return manifest;
+    }
+
+    /// @brief Resolve JClassS<ClassName>::getCachedClass()
+    template<const char ClassName[]>
+    JManifest& addClass()
+    {
+        return addEntry("class", ClassName, {}, [](JEnv&) {
+            JClassS<ClassName>::getCachedClass();
+        });
+    }
+
+    template<const char ClassName[], typename TSignature>
+    JManifest& add(JMethod<TSignature>& method, const char* name)
+    {
+        return addEntry("method", ClassName, name, [&method, name](JEnv&) {
+            method.resolve(JClassS<ClassName>::getCachedClass(), name);
+        });
+    }
+
+    template<const char ClassName[], typename TSignature>
+    JManifest& add(JStaticMethod<TSignature>& method, const char* name)
+    {
+        return addEntry("static method", ClassName, name, [&method, name](JEnv&) {
+            method.resolve(JClassS<ClassName>::getCachedClass(), name);
+        });
+    }
+
+    template<const char ClassName[], typename... TArgs>
+    JManifest& add(JConstructor<TArgs...>& constructor)
+    {
+        return addEntry("constructor", ClassName, {}, [&constructor](JEnv&) {
+            constructor.resolve(JClassS<ClassName>::getCachedClass());
+        });
+    }
+
+    template<const char ClassName[], typename T>
+    JManifest& add(JField<T>& field, const char* name)
+    {
+        return addEntry("field", ClassName, name, [&field, name](JEnv&) {
+            field.resolve(JClassS<ClassName>::getCachedClass(), name);
+        });
+    }
+
+    template<const char ClassName[], typename T>
+    JManifest& add(JStaticField<T>& field, const char* name)
+    {
+        return addEntry("static field", ClassName, name, [&field, name](JEnv&) {
+            field.resolve(JClassS<ClassName>::getCachedClass(), name);
+        });
+    }
+
+    template<const char ClassName[], typename T>
+    JManifest& add(JStaticConstant<T>& constant, const char* name)
+    {
+        return addEntry("constant", ClassName, name, [&constant, name](JEnv& env) {
+            constant.loadJni(env, JClassS<ClassName>::getCachedClass(), name);
+        });
+    }
+
+    /// @brief Load the constant table of a mapped enum (see JEnumMapping)
+    template<typename TEnum>
+    JManifest& addEnum()
+    {
+        return addEntry("enum", JEnumTraits<TEnum>::getClassName(), {}, [](JEnv&) {
+            JEnumMapping<TEnum>::load();
+        });
+    }
+
+    /// @brief Add any other resolver, errors are reported from the exceptions it throws
+    JManifest& addEntry(std::string kind, std::string className, std::string name, std::function<void(JEnv&)> resolver)
+    {
+        resolvers.push_back({ Entry { std::move(kind), std::move(className), std::move(name), {}, {} }, std::move(resolver) });
+        return *this;
+    }
+
+    /// @brief Resolve all entries, failed entries are reported instead of stopping the batch
+    Report resolve() const
+    {
+        auto env = JVM::getEnv();
+        return resolveJni(env);
+    }
+
+    Report resolveJni(JEnv& env) const
+    {
+        using Clock = std::chrono::steady_clock;
+        Report report;
+        report.entries.reserve(resolvers.size());
+        const auto start = Clock::now();
+        for (const auto& resolver : resolvers)
+        {
+            auto entry = resolver.first;
+            const auto entryStart = Clock::now();
+            try
+            {
+                resolver.second(env);
+            }
+            catch (const std::exception& e)
+            {
+                entry.error = e.what();
+            }
+            if (env->ExceptionCheck())
+            {
+                env->ExceptionClear();
+                if (entry.error.empty())
+                {
+                    entry.error = "Java exception";
+                }
+            }
+            entry.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - entryStart);
+            report.entries.push_back(std::move(entry));
+        }
+        report.duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+        return report;
+    }
+
+    /// @brief Resolve all entries and throw std::runtime_error listing every missing member
+    Report resolveOrThrow() const
+    {
+        auto report = resolve();
+        if (report.hasErrors())
+        {
+            throw std::runtime_error("Failed to resolve JNI manifest:\n" + report.getErrors());
+        }
+        return report;
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return resolvers.size();
+    }
+
+private:
+    std::vector<std::pair<Entry, std::function<void(JEnv&)>>> resolvers;
+};
+
+}
+
+#endif // __GUSC_JMANIFEST_HPP
@@ -0,0 +1,413 @@
+#ifndef __GUSC_JMETHOD_HPP
+#define __GUSC_JMETHOD_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JObject.hpp"
+#include "JClass.hpp"
+#include "JArray.hpp"
+#include "private/signature.hpp"
+#include "private/field.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+namespace Private
+{
+
+/// @brief Number of objects created between PushLocalFrame and PopLocalFrame by the bulk factories
+constexpr jint objectFrameSize { 256 };
+
+template<typename TValue, typename... TValues>
+inline std::size_t get_column_size(const std::vector<TValue>& column, const std::vector<TValues>&... columns)
+{
+    if (((columns.size() != column.size()) || ...))
+    {
+        throw std::invalid_argument("All columns must have the same size");
+    }
+    return column.size();
+}
+
+/// @brief Fill a new object array with objects returned by factory(index), local references are released in frames
+template<typename TFactory>
+inline JObjectArray create_object_array(JEnv& env, jclass cls, std::size_t count, TFactory&& factory)
+{
+    auto array = env->NewObjectArray(static_cast<jsize>(count), cls, nullptr);
+    if (!array)
+    {
+        JEnv::checkException(env);
+        throw std::runtime_error("Failed to create Java object array");
+    }
+    JObjectArray res { array };
+    env->DeleteLocalRef(array);
+    for (std::size_t frameBegin = 0; frameBegin < count; frameBegin += objectFrameSize)
+    {
+        const auto frameEnd = std::min(count, frameBegin + objectFrameSize);
+        if (env->PushLocalFrame(objectFrameSize) != JNI_OK)
+        {
+            env->ExceptionClear();
+            throw std::runtime_error("Failed to allocate local reference frame");
+        }
+        for (auto i = frameBegin; i < frameEnd; ++i)
+        {
+            auto obj = factory(i);
+            if (!obj)
+            {
+                env->PopLocalFrame(nullptr);
+                JEnv::checkException(env);
+                throw std::runtime_error("Failed to create Java object");
+            }
+            env->SetObjectArrayElement(res, static_cast<jsize>(i), obj);
+        }
+        env->PopLocalFrame(nullptr);
+    }
+    return res;
+}
+
+}
+
+template<typename TSignature>
+class JMethod;
+
+template<typename TSignature>
+class JStaticMethod;
+
+/// @brief Instance method handle that is resolved once and can be invoked on any object of the class
+/// @code
+///   JMethod<jint(jint, JString)> method { cls, "myMethod" };
+///   auto res = method(obj, 1, str);
+template<typename TReturn, typename... TArgs>
+class JMethod<TReturn(TArgs...)> final
+{
+public:
+    /// @brief create an unresolved method handle
+    JMethod() = default;
+    /// @brief resolve method by name (the signature is automatically generated at compile time from TReturn and TArgs... types)
+    JMethod(const JClass& initClass, const std::string& name)
+    {
+        resolve(initClass, name);
+    }
+    JMethod(const JMethod&) = default;
+    JMethod& operator=(const JMethod&) = default;
+    JMethod(JMethod&&) = default;
+    JMethod& operator=(JMethod&&) = default;
+    ~JMethod() = default;
+
+    inline void resolve(const JClass& initClass, const std::string& name)
+    {
+        methodId = initClass.getMethodIdSign(name, signature.str);
+        cls = initClass.createGlobalRef();
+    }
+
+    inline operator bool() const noexcept
+    {
+        return methodId != nullptr;
+    }
+
+    inline TReturn operator()(const JObject& obj, const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        return invokeJni(env, obj, std::forward<const TArgs&>(args)...);
+    }
+
+    inline TReturn invokeJni(JEnv& env, const JObject& obj, const TArgs&... args) const
+    {
+        return obj.invokeMethodJni<TReturn, TArgs...>(env, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    /// @brief Invoke the implementation of the class the handle was resolved on, bypassing virtual dispatch
+    /// (i.e. a superclass implementation or a known final method)
+    inline TReturn invokeNonvirtual(const JObject& obj, const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        return invokeNonvirtualJni(env, obj, std::forward<const TArgs&>(args)...);
+    }
+
+    inline TReturn invokeNonvirtualJni(JEnv& env, const JObject& obj, const TArgs&... args) const
+    {
+        return obj.invokeNonvirtualJni<TReturn, TArgs...>(env, cls, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    inline jmethodID getMethodId() const noexcept
+    {
+        return methodId;
+    }
+
+    inline const JClass& getClass() const noexcept
+    {
+        return cls;
+    }
+
+    static constexpr const char* getSignature()
+    {
+        return signature.str;
+    }
+
+private:
+    static constexpr auto signature = Private::getMethodSignature<TReturn, TArgs...>();
+
+    JClass cls { nullptr };
+    jmethodID methodId { nullptr };
+};
+
+/// @brief Static method handle that is resolved once
+/// @code
+///   JStaticMethod<jint(jint)> method { cls, "myStaticMethod" };
+///   auto res = method(1);
+template<typename TReturn, typename... TArgs>
+class JStaticMethod<TReturn(TArgs...)> final
+{
+public:
+    /// @brief create an unresolved method handle
+    JStaticMethod() = default;
+    /// @brief resolve static method by name (the signature is automatically generated at compile time from TReturn and TArgs... types)
+    JStaticMethod(const JClass& initClass, const std::string& name)
+    {
+        resolve(initClass, name);
+    }
+    JStaticMethod(const JStaticMethod&) = default;
+    JStaticMethod& operator=(const JStaticMethod&) = default;
+    JStaticMethod(JStaticMethod&&) = default;
+    JStaticMethod& operator=(JStaticMethod&&) = default;
+    ~JStaticMethod() = default;
+
+    inline void resolve(const JClass& initClass, const std::string& name)
+    {
+        methodId = initClass.getStaticMethodIdSign(name, signature.str);
+        cls = initClass.createGlobalRef();
+    }
+
+    inline operator bool() const noexcept
+    {
+        return methodId != nullptr;
+    }
+
+    inline TReturn operator()(const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        return invokeJni(env, std::forward<const TArgs&>(args)...);
+    }
+
+    inline TReturn invokeJni(JEnv& env, const TArgs&... args) const
+    {
+        return cls.invokeMethodJni<TReturn, TArgs...>(env, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    inline jmethodID getMethodId() const noexcept
+    {
+        return methodId;
+    }
+
+    inline const JClass& getClass() const noexcept
+    {
+        return cls;
+    }
+
+    static constexpr const char* getSignature()
+    {
+        return signature.str;
+    }
+
+private:
+    static constexpr auto signature = Private::getMethodSignature<TReturn, TArgs...>();
+
+    JClass cls { nullptr };
+    jmethodID methodId { nullptr };
+};
+
+/// @brief Constructor handle that is resolved once
+/// @code
+///   JConstructor<jlong> ctor { cls };
+///   JObject obj = ctor(1);
+template<typename... TArgs>
+class JConstructor final
+{
+public:
+    /// @brief create an unresolved constructor handle
+    JConstructor() = default;
+    /// @brief resolve constructor (the signature is automatically generated at compile time from TArgs... types)
+    JConstructor(const JClass& initClass)
+    {
+        resolve(initClass);
+    }
+    JConstructor(const JConstructor&) = default;
+    JConstructor& operator=(const JConstructor&) = default;
+    JConstructor(JConstructor&&) = default;
+    JConstructor& operator=(JConstructor&&) = default;
+    ~JConstructor() = default;
+
+    inline void resolve(const JClass& initClass)
+    {
+        methodId = initClass.getMethodIdSign("<init>", signature.str);
+        cls = initClass.createGlobalRef();
+    }
+
+    inline operator bool() const noexcept
+    {
+        return methodId != nullptr;
+    }
+
+    inline JObject operator()(const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        return createObjectJni(env, std::forward<const TArgs&>(args)...);
+    }
+
+    inline JObject createObjectJni(JEnv& env, const TArgs&... args) const
+    {
+        return cls.createObjectJni<TArgs...>(env, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    /// @brief Create an object for every row of the columns and return them in a new object array
+    /// @code
+    ///   JConstructor<jlong, jint> ctor { eventClass };
+    ///   auto events = ctor.createArray(timestamps, types);
+    inline JObjectArray createArray(const std::vector<TArgs>&... columns) const
+    {
+        auto env = JVM::getEnv();
+        return createArrayJni(env, columns...);
+    }
+
+    JObjectArray createArrayJni(JEnv& env, const std::vector<TArgs>&... columns) const
+    {
+        const auto count = Private::get_column_size(columns...);
+        return Private::create_object_array(env, cls, count, [&](std::size_t i) {
+            return env->NewObject(cls, methodId, Private::to_jni(columns[i])...);
+        });
+    }
+
+    inline jmethodID getMethodId() const noexcept
+    {
+        return methodId;
+    }
+
+    inline const JClass& getClass() const noexcept
+    {
+        return cls;
+    }
+
+    static constexpr const char* getSignature()
+    {
+        return signature.str;
+    }
+
+private:
+    static constexpr auto signature = Private::getMethodSignature<void, TArgs...>();
+
+    JClass cls { nullptr };
+    jmethodID methodId { nullptr };
+};
+
+/// @brief Factory for classes with trivial constructors that allocates objects with AllocObject and
+/// initializes the fields directly, the Java constructor is not run
+/// @code
+///   JFieldConstructor<jlong, jint> factory { eventClass, "timestamp", "type" };
+///   auto events = factory.createArray(timestamps, types);
+template<typename... TFields>
+class JFieldConstructor final
+{
+    template<typename>
+    using FieldName = const char*;
+
+public:
+    /// @brief create an unresolved factory
+    JFieldConstructor() = default;
+    /// @brief resolve fields by name (the signatures are automatically generated at compile time from TFields... types)
+    JFieldConstructor(const JClass& initClass, FieldName<TFields>... names)
+    {
+        resolve(initClass, names...);
+    }
+    JFieldConstructor(const JFieldConstructor&) = default;
+    JFieldConstructor& operator=(const JFieldConstructor&) = default;
+    JFieldConstructor(JFieldConstructor&&) = default;
+    JFieldConstructor& operator=(JFieldConstructor&&) = default;
+    ~JFieldConstructor() = default;
+
+    inline void resolve(const JClass& initClass, FieldName<TFields>... names)
+    {
+        auto env = JVM::getEnv();
+        const std::array<const char*, sizeof...(TFields)> fieldNames { names... };
+        resolveJni(env, initClass, fieldNames, std::index_sequence_for<TFields...>{});
+        cls = initClass.createGlobalRefJni(env);
+    }
+
+    inline operator bool() const noexcept
+    {
+        return static_cast<jclass>(cls) != nullptr;
+    }
+
+    inline JObject operator()(const TFields&... values) const
+    {
+        auto env = JVM::getEnv();
+        return createObjectJni(env, values...);
+    }
+
+    JObject createObjectJni(JEnv& env, const TFields&... values) const
+    {
+        auto obj = allocJni(env, values...);
+        if (!obj)
+        {
+            JEnv::checkException(env);
+            throw std::runtime_error("Failed to allocate Java object");
+        }
+        JObject res { obj };
+        env->DeleteLocalRef(obj);
+        return res;
+    }
+
+    /// @brief Create an object for every row of the columns and return them in a new object array
+    inline JObjectArray createArray(const std::vector<TFields>&... columns) const
+    {
+        auto env = JVM::getEnv();
+        return createArrayJni(env, columns...);
+    }
+
+    JObjectArray createArrayJni(JEnv& env, const std::vector<TFields>&... columns) const
+    {
+        const auto count = Private::get_column_size(columns...);
+        return Private::create_object_array(env, cls, count, [&](std::size_t i) {
+            return allocJni(env, columns[i]...);
+        });
+    }
+
+    inline const JClass& getClass() const noexcept
+    {
+        return cls;
+    }
+
+private:
+    JClass cls { nullptr };
+    std::array<jfieldID, sizeof...(TFields)> fieldIds {};
+
+    template<std::size_t... I>
+    inline void resolveJni(JEnv& env, const JClass& initClass, const std::array<const char*, sizeof...(TFields)>& names, std::index_sequence<I...>)
+    {
+        ((fieldIds[I] = initClass.getFieldIdJni(env, names[I], Private::getJTypeSignature<TFields>().str)), ...);
+    }
+
+    inline jobject allocJni(JEnv& env, const TFields&... values) const noexcept
+    {
+        auto obj = env->AllocObject(cls);
+        if (obj)
+        {
+            setJni(env, obj, std::index_sequence_for<TFields...>{}, values...);
+        }
+        return obj;
+    }
+
+    template<std::size_t... I>
+    inline void setJni(JEnv& env, jobject obj, std::index_sequence<I...>, const TFields&... values) const noexcept
+    {
+        (Private::setFieldValue<TFields>(env, obj, fieldIds[I], values), ...);
+    }
+};
+
+}
+
+#endif // __GUSC_JMETHOD_HPP
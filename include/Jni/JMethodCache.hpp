@@ -0,0 +1,182 @@
+#ifndef __GUSC_JMETHODCACHE_HPP
+#define __GUSC_JMETHODCACHE_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JObject.hpp"
+#include "private/signature.hpp"
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+
+namespace gusc::Jni
+{
+
+/// @brief Polymorphic inline cache of instance method IDs keyed by the receiver class
+/// Keep one instance per call site, it remembers method IDs for up to N distinct receiver classes
+/// and falls back to the method ID resolved against the declared class once all slots are taken.
+/// Without a declared class (JObject::invokeMethodCached) there is no fallback - once the slots are taken every
+/// other receiver class pays for a GetMethodID call, so size N for the expected number of receiver classes.
+/// @code
+///   static JMethodCache<void(jint)> onLevel { "onLevel" };
+///   for (const auto& listener : listeners)
+///   {
+///       listener.invokeMethodCached(onLevel, level);
+///   }
+template<typename TReturn, typename... TArgs, std::size_t N>
+class JMethodCache<TReturn(TArgs...), N> final
+{
+public:
+    static_assert(N > 0, "JMethodCache needs at least one slot");
+
+    JMethodCache(const std::string& initName)
+        : name(initName)
+    {}
+    JMethodCache(const JMethodCache&) = delete;
+    JMethodCache& operator=(const JMethodCache&) = delete;
+    JMethodCache(JMethodCache&&) = delete;
+    JMethodCache& operator=(JMethodCache&&) = delete;
+    /// @brief Release the cached classes if the current thread is attached, otherwise they are leaked
+    /// (static caches are destroyed during exit, when the thread must not be attached and the JVM may be gone)
+    ~JMethodCache()
+    {
+        const auto count = size.load(std::memory_order_acquire);
+        if (!count)
+        {
+            return;
+        }
+        if (auto env = JVM::getAttachedEnv())
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                env->DeleteGlobalRef(entries[i].cls);
+            }
+        }
+    }
+
+    /// @brief Get method ID for the receiver object
+    /// @param declaredClass - class to resolve against when the cache is full (can be nullptr - then misses
+    /// on a full cache resolve against the receiver class on every call)
+    jmethodID getMethodIdJni(JEnv& env, jobject receiver, jclass declaredClass)
+    {
+        auto receiverClass = env->GetObjectClass(receiver);
+        const auto count = size.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (env->IsSameObject(entries[i].cls, receiverClass) == JNI_TRUE)
+            {
+                env->DeleteLocalRef(receiverClass);
+                return entries[i].methodId;
+            }
+        }
+        // Slots are never replaced once the cache is full, so misses don't need the lock
+        const auto methodId = count < N ? resolve(env, receiverClass, declaredClass) : resolveFull(env, receiverClass, declaredClass);
+        env->DeleteLocalRef(receiverClass);
+        return methodId;
+    }
+
+    template<typename... TCallArgs>
+    inline TReturn invokeJni(JEnv& env, const JObject& receiver, jclass declaredClass, const TCallArgs&... args)
+    {
+        const auto methodId = getMethodIdJni(env, receiver, declaredClass);
+        return receiver.invokeMethodJni<TReturn, TArgs...>(env, methodId, std::forward<const TCallArgs&>(args)...);
+    }
+
+    /// @brief Number of receiver classes currently held in the cache
+    inline std::size_t getSize() const noexcept
+    {
+        return size.load(std::memory_order_acquire);
+    }
+
+    static constexpr const char* getSignature()
+    {
+        return signature.str;
+    }
+
+private:
+    struct Entry
+    {
+        jclass cls { nullptr };
+        jmethodID methodId { nullptr };
+    };
+
+    static constexpr auto signature = Private::getMethodSignature<TReturn, TArgs...>();
+
+    std::string name;
+    std::array<Entry, N> entries {};
+    std::atomic<std::size_t> size { 0 };
+    std::atomic<jmethodID> declaredMethodId { nullptr };
+    std::mutex mutex;
+
+    jmethodID resolve(JEnv& env, jclass receiverClass, jclass declaredClass)
+    {
+        {
+            std::lock_guard lock { mutex };
+            const auto count = size.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (env->IsSameObject(entries[i].cls, receiverClass) == JNI_TRUE)
+                {
+                    return entries[i].methodId;
+                }
+            }
+            if (count < N)
+            {
+                const auto methodId = getMethodId(env, receiverClass);
+                entries[count].cls = static_cast<jclass>(env->NewGlobalRef(receiverClass));
+                entries[count].methodId = methodId;
+                size.store(count + 1, std::memory_order_release);
+                return methodId;
+            }
+        }
+        return resolveFull(env, receiverClass, declaredClass);
+    }
+
+    jmethodID resolveFull(JEnv& env, jclass receiverClass, jclass declaredClass)
+    {
+        if (!declaredClass)
+        {
+            // No megamorphic fallback without a declared class
+            return getMethodId(env, receiverClass);
+        }
+        // Megamorphic call site - a method ID of the declared class is valid for every receiver
+        if (auto methodId = declaredMethodId.load(std::memory_order_acquire))
+        {
+            return methodId;
+        }
+        const auto methodId = getMethodId(env, declaredClass);
+        declaredMethodId.store(methodId, std::memory_order_release);
+        return methodId;
+    }
+
+    jmethodID getMethodId(JEnv& env, jclass cls) const
+    {
+        auto methodId = env->GetMethodID(cls, name.c_str(), signature.str);
+        if (!methodId)
+        {
+            env->ExceptionClear();
+            throw std::runtime_error(std::string("Can't find instance method ") + name + " with signature " + signature.str);
+        }
+        return methodId;
+    }
+};
+
+template<typename TReturn, std::size_t N, typename... TArgs, typename... TCallArgs>
+inline TReturn JObject::invokeMethodCached(JMethodCache<TReturn(TArgs...), N>& cache, const TCallArgs&... args) const
+{
+    auto env = JVM::getEnv();
+    return cache.invokeJni(env, *this, nullptr, std::forward<const TCallArgs&>(args)...);
+}
+
+template<const char ClassName[]>
+template<typename TReturn, std::size_t N, typename... TArgs, typename... TCallArgs>
+inline TReturn JObjectS<ClassName>::invokeMethodCached(JMethodCache<TReturn(TArgs...), N>& cache, const TCallArgs&... args) const
+{
+    auto env = JVM::getEnv();
+    return cache.invokeJni(env, *this, JClassS<ClassName>::getCachedClass(), std::forward<const TCallArgs&>(args)...);
+}
+
+}
+
+#endif // __GUSC_JMETHODCACHE_HPP
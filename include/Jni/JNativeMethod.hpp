@@ -0,0 +1,194 @@
+#ifndef __GUSC_JNATIVEMETHOD_HPP
+#define __GUSC_JNATIVEMETHOD_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JClass.hpp"
+#include "JNativePeer.hpp"
+#include "JException.hpp"
+#include "private/signature.hpp"
+#include "private/cast.hpp"
+#include "private/field.hpp"
+#include <stdexcept>
+#include <type_traits>
+
+namespace gusc::Jni
+{
+
+namespace Private
+{
+
+/// @brief Convert a native method argument to the type expected by the C++ method
+template<typename T>
+inline
+typename std::enable_if_t<
+    is_jni_wrapper_v<T>,
+    T
+> from_jni_arg(jni_type_t<T> in)
+{
+    return T(in);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    !is_jni_wrapper_v<T>,
+    T
+> from_jni_arg(T in) noexcept
+{
+    return in;
+}
+
+/// @brief Convert a C++ method return value to the type returned to Java, wrapper types release their reference
+template<typename T>
+inline
+typename std::enable_if_t<
+    is_jni_wrapper_v<T>,
+    jni_type_t<T>
+> to_jni_return(T&& in) noexcept
+{
+    return static_cast<jni_type_t<T>>(in.release());
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    !is_jni_wrapper_v<T>,
+    T
+> to_jni_return(T&& in) noexcept
+{
+    return in;
+}
+
+template<auto Method, typename TClass, typename TReturn, typename... TArgs>
+struct native_trampoline_impl
+{
+    using Return = std::decay_t<TReturn>;
+    using JniReturn = jni_type_t<Return>;
+
+    static constexpr auto signature = getMethodSignature<Return, std::decay_t<TArgs>...>();
+
+    static JniReturn invoke(JNIEnv* env, jobject thiz, jni_type_t<std::decay_t<TArgs>>... args)
+    {
+        JEnvScope scope { env };
+        try
+        {
+            auto peer = JNativePeer<TClass>::get(env, thiz);
+            if (!peer)
+            {
+                throw std::logic_error("Java object does not have a live native peer");
+            }
+            if constexpr (std::is_void_v<Return>)
+            {
+                (peer->*Method)(from_jni_arg<std::decay_t<TArgs>>(args)...);
+                return;
+            }
+            else
+            {
+                return to_jni_return<Return>((peer->*Method)(from_jni_arg<std::decay_t<TArgs>>(args)...));
+            }
+        }
+        catch (...)
+        {
+            JEnv jniEnv { env };
+            JExceptionRegistry::throwJni(jniEnv);
+        }
+        if constexpr (!std::is_void_v<Return>)
+        {
+            return JniReturn{};
+        }
+    }
+
+    static inline void* getFunction() noexcept
+    {
+        auto fn = &invoke;
+        return void_cast(fn);
+    }
+};
+
+template<typename TMethod, TMethod Method>
+struct native_trampoline;
+
+template<typename TClass, typename TReturn, typename... TArgs, TReturn(TClass::*Method)(TArgs...)>
+struct native_trampoline<TReturn(TClass::*)(TArgs...), Method>
+    : native_trampoline_impl<Method, TClass, TReturn, TArgs...>
+{};
+
+template<typename TClass, typename TReturn, typename... TArgs, TReturn(TClass::*Method)(TArgs...) const>
+struct native_trampoline<TReturn(TClass::*)(TArgs...) const, Method>
+    : native_trampoline_impl<Method, TClass, TReturn, TArgs...>
+{};
+
+/// @brief Free functions that already have the JNI calling convention are only wrapped with JEnvScope and exception translation
+template<typename TReturn, typename... TArgs, TReturn(*Function)(JNIEnv*, jobject, TArgs...)>
+struct native_trampoline<TReturn(*)(JNIEnv*, jobject, TArgs...), Function>
+{
+    static constexpr auto signature = getMethodSignature<TReturn, TArgs...>();
+
+    static TReturn invoke(JNIEnv* env, jobject thiz, TArgs... args)
+    {
+        JEnvScope scope { env };
+        try
+        {
+            return Function(env, thiz, args...);
+        }
+        catch (...)
+        {
+            JEnv jniEnv { env };
+            JExceptionRegistry::throwJni(jniEnv);
+        }
+        if constexpr (!std::is_void_v<TReturn>)
+        {
+            return TReturn{};
+        }
+    }
+
+    static inline void* getFunction() noexcept
+    {
+        auto fn = &invoke;
+        return void_cast(fn);
+    }
+};
+
+}
+
+/// @brief Compile-time generated native method entry point
+/// The incoming JNIEnv is installed with JEnvScope for the duration of the call and C++ exceptions
+/// are thrown in Java through JExceptionRegistry. Member functions are bound through JNativePeer<TClass>,
+/// so the class must be bound to its Java class before any of the native methods are called.
+/// If the Java object has no live native peer an IllegalStateException is thrown in Java.
+/// @code
+///   cls.registerNativeMethods({
+///       JNativeMethod<&MyPlugin::process>::describe("nativeProcess"),
+///       JNativeMethod<&MyPlugin::getLevel>::describe("nativeGetLevel")
+///   });
+template<auto Method>
+class JNativeMethod final
+{
+public:
+    JNativeMethod() = delete;
+
+    /// @brief Describe native method for JClass::registerNativeMethods
+    static inline JNINativeMethod describe(const char* name) noexcept
+    {
+        return { name, getSignature(), Trampoline::getFunction() };
+    }
+
+    static constexpr const char* getSignature()
+    {
+        return Trampoline::signature.str;
+    }
+
+private:
+    using Trampoline = Private::native_trampoline<decltype(Method), Method>;
+};
+
+template<auto Method>
+inline void JClass::registerNativeMethod(const std::string& name)
+{
+    registerNativeMethods({ JNativeMethod<Method>::describe(name.c_str()) });
+}
+
+}
+
+#endif // __GUSC_JNATIVEMETHOD_HPP
@@ -0,0 +1,303 @@
+#ifndef __GUSC_JNATIVEPEER_HPP
+#define __GUSC_JNATIVEPEER_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JClass.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+/// @brief Generational handle table that maps jlong handles to native instances
+/// A handle packs a slot index and the slot's generation, once the entry is erased the generation
+/// is bumped, so any stale handle still held by Java resolves to nullptr instead of a dangling pointer.
+/// Lookups are lock-free, insert and erase are serialized with a mutex.
+/// @note the table only protects against stale handles, not against concurrent frees - get() returns a raw
+/// pointer that another thread can erase and delete while it is still in use, so deleting an erased instance
+/// must be synchronized with calls that may still be using it (i.e. join the threads or drain the queues that
+/// call into it first)
+template<typename T>
+class JHandleTable final
+{
+public:
+    using Handle = jlong;
+
+    static constexpr Handle invalidHandle { 0 };
+
+    JHandleTable() = default;
+    JHandleTable(const JHandleTable&) = delete;
+    JHandleTable& operator=(const JHandleTable&) = delete;
+    JHandleTable(JHandleTable&&) = delete;
+    JHandleTable& operator=(JHandleTable&&) = delete;
+    ~JHandleTable()
+    {
+        for (auto& chunk : chunks)
+        {
+            delete chunk.load(std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Store pointer in the table
+    /// @return handle that can be stored in a Java long field
+    Handle insert(T* ptr)
+    {
+        if (!ptr)
+        {
+            throw std::invalid_argument("Can't insert nullptr in to handle table");
+        }
+        std::lock_guard lock { mutex };
+        std::uint32_t index { 0 };
+        if (!freeList.empty())
+        {
+            index = freeList.back();
+            freeList.pop_back();
+        }
+        else
+        {
+            index = nextIndex;
+            if (index >= chunkSize * maxChunks)
+            {
+                throw std::runtime_error("Handle table is full");
+            }
+            auto& chunk = chunks[index / chunkSize];
+            if (!chunk.load(std::memory_order_relaxed))
+            {
+                chunk.store(new Chunk{}, std::memory_order_release);
+            }
+            ++nextIndex;
+        }
+        auto& slot = getSlot(index);
+        slot.ptr.store(ptr, std::memory_order_release);
+        return makeHandle(index, slot.generation.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Get pointer by handle
+    /// @return nullptr if the handle is invalid or stale
+    T* get(Handle handle) const noexcept
+    {
+        const auto index = getIndex(handle);
+        const auto generation = getGeneration(handle);
+        if (index >= chunkSize * maxChunks)
+        {
+            return nullptr;
+        }
+        const auto chunk = chunks[index / chunkSize].load(std::memory_order_acquire);
+        if (!chunk)
+        {
+            return nullptr;
+        }
+        const auto& slot = (*chunk)[index % chunkSize];
+        if (slot.generation.load(std::memory_order_acquire) != generation)
+        {
+            return nullptr;
+        }
+        const auto ptr = slot.ptr.load(std::memory_order_acquire);
+        // Entry was erased while we were reading it
+        if (slot.generation.load(std::memory_order_acquire) != generation)
+        {
+            return nullptr;
+        }
+        return ptr;
+    }
+
+    /// @brief Remove entry from the table, the handle and all its copies become stale
+    /// @return pointer that was stored or nullptr if the handle was already stale
+    T* erase(Handle handle) noexcept
+    {
+        std::lock_guard lock { mutex };
+        const auto ptr = get(handle);
+        if (!ptr)
+        {
+            return nullptr;
+        }
+        const auto index = getIndex(handle);
+        auto& slot = getSlot(index);
+        slot.ptr.store(nullptr, std::memory_order_release);
+        const auto generation = getGeneration(handle);
+        if (generation < std::numeric_limits<std::uint32_t>::max())
+        {
+            slot.generation.store(generation + 1, std::memory_order_release);
+            freeList.push_back(index);
+        }
+        else
+        {
+            // Generation space is exhausted - retire the slot for good, so old handles can never match again
+            slot.generation.store(0, std::memory_order_release);
+        }
+        return ptr;
+    }
+
+    /// @brief Check if the handle points to a live entry
+    inline bool contains(Handle handle) const noexcept
+    {
+        return get(handle) != nullptr;
+    }
+
+private:
+    static constexpr std::uint32_t chunkSize { 256 };
+    static constexpr std::uint32_t maxChunks { 1024 };
+
+    struct Slot
+    {
+        std::atomic<std::uint32_t> generation { 1 };
+        std::atomic<T*> ptr { nullptr };
+    };
+    using Chunk = std::array<Slot, chunkSize>;
+
+    std::array<std::atomic<Chunk*>, maxChunks> chunks {};
+    std::uint32_t nextIndex { 0 };
+    std::vector<std::uint32_t> freeList;
+    std::mutex mutex;
+
+    inline Slot& getSlot(std::uint32_t index) noexcept
+    {
+        return (*chunks[index / chunkSize].load(std::memory_order_relaxed))[index % chunkSize];
+    }
+
+    static inline Handle makeHandle(std::uint32_t index, std::uint32_t generation) noexcept
+    {
+        // Index is stored + 1, so that 0 (the default value of a Java long field) is never a valid handle
+        return static_cast<Handle>((static_cast<std::uint64_t>(generation) << 32) | (static_cast<std::uint64_t>(index) + 1));
+    }
+
+    static inline std::uint32_t getIndex(Handle handle) noexcept
+    {
+        return static_cast<std::uint32_t>(static_cast<std::uint64_t>(handle) & 0xFFFFFFFFu) - 1;
+    }
+
+    static inline std::uint32_t getGeneration(Handle handle) noexcept
+    {
+        return static_cast<std::uint32_t>(static_cast<std::uint64_t>(handle) >> 32);
+    }
+};
+
+/// @brief Native peer registry for Java objects that own a native C++ instance
+/// The Java class stores a handle from the JHandleTable<T> in a long field. The field ID is resolved
+/// once in bind(), so a lookup from a native method is a single GetLongField call plus a table read.
+/// Native calls that are already running keep the raw pointer returned by get() after another thread detaches
+/// the instance, so the owner must not delete a detached instance until such calls have returned.
+/// @code
+///   // JNI_OnLoad
+///   JNativePeer<MyPlugin>::bind(JVM::getEnv().getClass("my/package/Plugin"), "nativeHandle");
+///   // native method
+///   static void processJni(JNIEnv* env, jobject thiz)
+///   {
+///       if (auto plugin = JNativePeer<MyPlugin>::get(env, thiz))
+///       {
+///           plugin->process();
+///       }
+///   }
+template<typename T>
+class JNativePeer final
+{
+public:
+    using Handle = typename JHandleTable<T>::Handle;
+
+    JNativePeer() = delete;
+
+    /// @brief Resolve handle field of the Java class
+    static void bind(const JClass& cls, const std::string& fieldName = "nativePtr")
+    {
+        const auto newFieldId = cls.getFieldIdSign(fieldName, "J");
+        auto env = JVM::getEnv();
+        // Class is kept alive for the rest of the process so that the field ID never becomes invalid
+        auto newClass = static_cast<jclass>(env->NewGlobalRef(cls));
+        auto oldClass = boundClass.exchange(newClass, std::memory_order_acq_rel);
+        fieldId.store(newFieldId, std::memory_order_release);
+        if (oldClass)
+        {
+            env->DeleteGlobalRef(oldClass);
+        }
+    }
+
+    /// @brief Register native instance and get the handle to pass to Java
+    static inline Handle attach(T* ptr)
+    {
+        return getTable().insert(ptr);
+    }
+
+    /// @brief Register native instance and store the handle in the Java object
+    static Handle attach(JEnv& env, jobject obj, T* ptr)
+    {
+        const auto handle = attach(ptr);
+        env->SetLongField(obj, getFieldId(), handle);
+        return handle;
+    }
+
+    /// @brief Unregister native instance by handle
+    /// @return native instance or nullptr if the handle was stale
+    static inline T* detach(Handle handle) noexcept
+    {
+        return getTable().erase(handle);
+    }
+
+    /// @brief Unregister native instance of the Java object and clear its handle field
+    /// @return native instance or nullptr if the object did not have a live handle
+    static T* detach(JEnv& env, jobject obj)
+    {
+        const auto id = getFieldId();
+        const auto handle = env->GetLongField(obj, id);
+        env->SetLongField(obj, id, JHandleTable<T>::invalidHandle);
+        return detach(handle);
+    }
+
+    /// @brief Get native instance by handle
+    /// @return native instance or nullptr if the handle is stale
+    static inline T* get(Handle handle) noexcept
+    {
+        return getTable().get(handle);
+    }
+
+    /// @brief Get native instance of the Java object
+    /// @return native instance or nullptr if the object does not have a live handle
+    static inline T* get(JNIEnv* env, jobject obj)
+    {
+        return get(env->GetLongField(obj, getFieldId()));
+    }
+
+    /// @brief Get native instance of the Java object
+    /// @throws std::runtime_error if the object does not have a live handle
+    static T& getChecked(JNIEnv* env, jobject obj)
+    {
+        const auto ptr = get(env, obj);
+        if (!ptr)
+        {
+            throw std::runtime_error("Java object does not have a live native peer");
+        }
+        return *ptr;
+    }
+
+    static inline jfieldID getFieldId()
+    {
+        const auto id = fieldId.load(std::memory_order_acquire);
+        if (!id)
+        {
+            throw std::runtime_error("Native peer is not bound to a Java class");
+        }
+        return id;
+    }
+
+    static inline JHandleTable<T>& getTable() noexcept
+    {
+        // Leaked intentionally - Java objects can outlive static destructors
+        static auto* table = new JHandleTable<T>();
+        return *table;
+    }
+
+private:
+    inline static std::atomic<jfieldID> fieldId { nullptr };
+    inline static std::atomic<jclass> boundClass { nullptr };
+};
+
+}
+
+#endif // __GUSC_JNATIVEPEER_HPP
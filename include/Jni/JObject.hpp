@@ -4,6 +4,8 @@
 #include "private/strutils.hpp"
 #include "private/signature.hpp"
 #include "private/cast.hpp"
+#include "private/jvalue.hpp"
+#include <future>
 #include <type_traits>
 
 namespace gusc::Jni
@@ -11,6 +13,9 @@ namespace gusc::Jni
 
 class JClass;
 class JString;
+class JThreadPool;
+template<typename T>
+class JResult;
 
 class JObject
 {
@@ -59,6 +64,11 @@ public:
     JObject createGlobalRef() const
     {
         auto env = JVM::getEnv();
+        return createGlobalRefJni(env);
+    }
+
+    JObject createGlobalRefJni(JEnv& env) const
+    {
         JObject other;
         other.jniObject = env->NewGlobalRef(jniObject);
         return other;
@@ -68,6 +78,11 @@ public:
     JObject createWeakGlobalRef() const
     {
         auto env = JVM::getEnv();
+        return createWeakGlobalRefJni(env);
+    }
+
+    JObject createWeakGlobalRefJni(JEnv& env) const
+    {
         JObject other;
         other.jniObject = env->NewWeakGlobalRef(jniObject);
         return other;
@@ -118,6 +133,7 @@ public:
     }
     JClass getClass(JEnv& env) const noexcept;
     JClass getClass() const noexcept;
+    static jmethodID getNonvirtualMethodIdJni(JEnv& env, jclass cls, const std::string& name, const std::string& signature);
 
     template<typename TReturn, typename... TArgs>
     inline
@@ -127,8 +143,13 @@ public:
     >
     invokeMethodJni(JEnv& env, jmethodID methodId, const TArgs&... args) const
     {
+#if defined(GUSC_JNI_JVALUE_INVOKE)
+        invokeMethodJniA<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+#else
+        JEnv::checkBatch(env);
         invokeMethodReturnVoid(env, methodId, std::forward<const TArgs&>(args)...);
-        JEnv::checkException(env);
+        JEnv::checkInvokeException(env);
+#endif
     }
 
     template<typename TReturn, typename... TArgs>
@@ -164,9 +185,14 @@ public:
     >
     invokeMethodJni(JEnv& env, jmethodID methodId, const TArgs&... args) const
     {
+#if defined(GUSC_JNI_JVALUE_INVOKE)
+        return invokeMethodJniA<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+#else
+        JEnv::checkBatch(env);
         auto res = invokeMethodReturn<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
-        JEnv::checkException(env);
+        JEnv::checkInvokeException(env);
         return res;
+#endif
     }
 
     template<typename TReturn, typename... TArgs>
@@ -194,6 +220,174 @@ public:
         return invokeMethodSign<TReturn>(name, sign.str, std::forward<const TArgs&>(args)...);
     }
 
+    /// @brief Invoke a method through Call<Type>MethodA with arguments packed into a jvalue array
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeMethodJniA(JEnv& env, jmethodID methodId, const TArgs&... args) const
+    {
+        JEnv::checkBatch(env);
+        const auto values = Private::to_jvalues(std::forward<const TArgs&>(args)...);
+        invokeMethodReturnVoidA(env, methodId, values.data());
+        JEnv::checkInvokeException(env);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeMethodSignA(const std::string& name, const std::string& signature, const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        auto methodId = getMethodIdJni(env, name, signature);
+        invokeMethodJniA<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeMethodA(const std::string& name, const TArgs&... args) const
+    {
+        constexpr auto sign = Private::getMethodSignature<TReturn, TArgs...>();
+        invokeMethodSignA<TReturn>(name, sign.str, std::forward<const TArgs&>(args)...);
+    }
+
+    /// @brief Invoke a method through Call<Type>MethodA with arguments packed into a jvalue array
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeMethodJniA(JEnv& env, jmethodID methodId, const TArgs&... args) const
+    {
+        JEnv::checkBatch(env);
+        const auto values = Private::to_jvalues(std::forward<const TArgs&>(args)...);
+        auto res = invokeMethodReturnA<TReturn>(env, methodId, values.data());
+        JEnv::checkInvokeException(env);
+        return res;
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeMethodSignA(const std::string& name, const std::string& signature, const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        const auto methodId = getMethodIdJni(env, name, signature);
+        return invokeMethodJniA<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeMethodA(const std::string& name, const TArgs&... args) const
+    {
+        constexpr auto sign = Private::getMethodSignature<TReturn, TArgs...>();
+        return invokeMethodSignA<TReturn>(name, sign.str, std::forward<const TArgs&>(args)...);
+    }
+
+    /// @brief Invoke the implementation of a method declared in class cls, bypassing virtual dispatch (CallNonvirtual<Type>MethodA)
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeNonvirtualJni(JEnv& env, jclass cls, jmethodID methodId, const TArgs&... args) const
+    {
+        JEnv::checkBatch(env);
+        const auto values = Private::to_jvalues(std::forward<const TArgs&>(args)...);
+        invokeNonvirtualReturnVoidA(env, cls, methodId, values.data());
+        JEnv::checkInvokeException(env);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeNonvirtualSign(jclass cls, const std::string& name, const std::string& signature, const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        const auto methodId = getNonvirtualMethodIdJni(env, cls, name, signature);
+        invokeNonvirtualJni<TReturn>(env, cls, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, void>,
+        void
+    >
+    invokeNonvirtual(jclass cls, const std::string& name, const TArgs&... args) const
+    {
+        constexpr auto sign = Private::getMethodSignature<TReturn, TArgs...>();
+        invokeNonvirtualSign<TReturn>(cls, name, sign.str, std::forward<const TArgs&>(args)...);
+    }
+
+    /// @brief Invoke the implementation of a method declared in class cls, bypassing virtual dispatch (CallNonvirtual<Type>MethodA)
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeNonvirtualJni(JEnv& env, jclass cls, jmethodID methodId, const TArgs&... args) const
+    {
+        JEnv::checkBatch(env);
+        const auto values = Private::to_jvalues(std::forward<const TArgs&>(args)...);
+        auto res = invokeNonvirtualReturnA<TReturn>(env, cls, methodId, values.data());
+        JEnv::checkInvokeException(env);
+        return res;
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeNonvirtualSign(jclass cls, const std::string& name, const std::string& signature, const TArgs&... args) const
+    {
+        auto env = JVM::getEnv();
+        const auto methodId = getNonvirtualMethodIdJni(env, cls, name, signature);
+        return invokeNonvirtualJni<TReturn>(env, cls, methodId, std::forward<const TArgs&>(args)...);
+    }
+
+    template<typename TReturn, typename... TArgs>
+    inline
+    typename std::enable_if_t<
+        !std::is_same_v<TReturn, void>,
+        TReturn
+    >
+    invokeNonvirtual(jclass cls, const std::string& name, const TArgs&... args) const
+    {
+        constexpr auto sign = Private::getMethodSignature<TReturn, TArgs...>();
+        return invokeNonvirtualSign<TReturn>(cls, name, sign.str, std::forward<const TArgs&>(args)...);
+    }
+
+    /// @brief Invoke instance method through a per call site inline cache of method IDs (see JMethodCache)
+    /// @note there is no declared class to fall back to - once the cache is full other receiver classes
+    /// resolve the method ID on every call (use JObjectS<ClassName>::invokeMethodCached for megamorphic call sites)
+    template<typename TReturn, std::size_t N, typename... TArgs, typename... TCallArgs>
+    TReturn invokeMethodCached(JMethodCache<TReturn(TArgs...), N>& cache, const TCallArgs&... args) const;
+
     template<typename T>
     T getFieldJni(JEnv& env, jfieldID fieldId) const noexcept
     {
@@ -236,6 +430,42 @@ public:
         setFieldSign<T>(name, sign.str, std::forward<const T&>(value));
     }
 
+    /// @brief Non-throwing variants of method/field lookup, invoke and field access (defined in JResult.hpp)
+    /// Lookup failures and Java exceptions are cleared from the env and returned as JResult errors
+    JResult<jmethodID> tryGetMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const;
+    JResult<jfieldID> tryGetFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const;
+
+    template<typename TReturn, typename... TArgs>
+    JResult<TReturn> tryInvokeMethodJni(JEnv& env, jmethodID methodId, const TArgs&... args) const;
+
+    template<typename TReturn, typename... TArgs>
+    JResult<TReturn> tryInvokeMethodSign(const std::string& name, const std::string& signature, const TArgs&... args) const;
+
+    template<typename TReturn, typename... TArgs>
+    JResult<TReturn> tryInvokeMethod(const std::string& name, const TArgs&... args) const;
+
+    template<typename T>
+    JResult<T> tryGetFieldSign(const std::string& name, const std::string& signature) const;
+
+    template<typename T>
+    JResult<T> tryGetField(const std::string& name) const;
+
+    template<typename T>
+    JResult<void> trySetFieldSign(const std::string& name, const std::string& signature, const T& value);
+
+    template<typename T>
+    JResult<void> trySetField(const std::string& name, const T& value);
+
+    /// @brief Invoke a method on a JThreadPool worker without waiting for it (defined in JAsync.hpp)
+    /// Object arguments and the receiver are promoted to global references for the hop, object results come back as global references
+    /// @note the calling thread must already be attached to the JVM, it is not attached implicitly
+    template<typename TReturn, typename... TArgs>
+    std::future<TReturn> invokeMethodAsync(JThreadPool& pool, const std::string& name, const TArgs&... args) const;
+
+    /// @brief Invoke a method on the default JThreadPool (see JThreadPool::getDefault)
+    template<typename TReturn, typename... TArgs>
+    std::future<TReturn> invokeMethodAsync(const std::string& name, const TArgs&... args) const;
+
 protected:
     jobject jniObject { nullptr };
 
@@ -420,6 +650,270 @@ protected:
         return JObject(invokeMethodReturn<jobject>(env, methodId, std::forward<const TArgs&>(args)...));
     }
 
+    inline void invokeMethodReturnVoidA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        env->CallVoidMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jboolean>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallBooleanMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jchar>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallCharMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jbyte>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallByteMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jshort>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallShortMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jint>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallIntMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jlong>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallLongMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jfloat>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallFloatMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jdouble>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallDoubleMethodA(jniObject, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+            !std::is_same_v<TReturn, jboolean> &&
+            !std::is_same_v<TReturn, jbyte> &&
+            !std::is_same_v<TReturn, jchar> &&
+            !std::is_same_v<TReturn, jshort> &&
+            !std::is_same_v<TReturn, jint> &&
+            !std::is_same_v<TReturn, jlong> &&
+            !std::is_same_v<TReturn, jfloat> &&
+            !std::is_same_v<TReturn, jdouble> &&
+            !std::is_same_v<TReturn, JString> &&
+            !std::is_same_v<TReturn, JObject>,
+            TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return static_cast<TReturn>(env->CallObjectMethodA(jniObject, methodId, args));
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, JString>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept;
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, JObject>,
+        TReturn
+    >
+    invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return JObject(invokeMethodReturnA<jobject>(env, methodId, args));
+    }
+
+    inline void invokeNonvirtualReturnVoidA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        env->CallNonvirtualVoidMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jboolean>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallNonvirtualBooleanMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jchar>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallNonvirtualCharMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jbyte>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallNonvirtualByteMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jshort>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallNonvirtualShortMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jint>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallNonvirtualIntMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jlong>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallNonvirtualLongMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jfloat>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallNonvirtualFloatMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, jdouble>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return env->CallNonvirtualDoubleMethodA(jniObject, cls, methodId, args);
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+            !std::is_same_v<TReturn, jboolean> &&
+            !std::is_same_v<TReturn, jbyte> &&
+            !std::is_same_v<TReturn, jchar> &&
+            !std::is_same_v<TReturn, jshort> &&
+            !std::is_same_v<TReturn, jint> &&
+            !std::is_same_v<TReturn, jlong> &&
+            !std::is_same_v<TReturn, jfloat> &&
+            !std::is_same_v<TReturn, jdouble> &&
+            !std::is_same_v<TReturn, JString> &&
+            !std::is_same_v<TReturn, JObject>,
+            TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return static_cast<TReturn>(env->CallNonvirtualObjectMethodA(jniObject, cls, methodId, args));
+    }
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, JString>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept;
+
+    template<typename TReturn>
+    inline
+    typename std::enable_if_t<
+        std::is_same_v<TReturn, JObject>,
+        TReturn
+    >
+    invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+    {
+        return JObject(invokeNonvirtualReturnA<jobject>(env, cls, methodId, args));
+    }
+
     template<typename T>
     inline
     typename std::enable_if_t<
@@ -716,6 +1210,11 @@ struct JObjectS : public JObject
         return JObjectS<ClassName> { createWeakGlobalRef() };
     }
 
+    /// @brief Invoke instance method through a per call site inline cache of method IDs
+    /// @note once the cache is full the method ID is resolved against ClassName instead of the receiver class
+    template<typename TReturn, std::size_t N, typename... TArgs, typename... TCallArgs>
+    TReturn invokeMethodCached(JMethodCache<TReturn(TArgs...), N>& cache, const TCallArgs&... args) const;
+
     static constexpr const char* getClassName()
     {
         return ClassName;
@@ -0,0 +1,302 @@
+#ifndef __GUSC_JPROFILE_HPP
+#define __GUSC_JPROFILE_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JManifest.hpp"
+#include "private/profile.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+/// @brief Records the classes and members resolved during a run and pre-resolves them on the next start
+/// Recording is only compiled in with the Jni_Profile build option (GUSC_JNI_PROFILE), saved profiles can be
+/// loaded and pre-resolved by any build.
+/// @code
+///   // profiling build
+///   JProfile::start();
+///   ...
+///   JProfile::save(cacheDir + "/jni.profile");
+///   // JNI_OnLoad
+///   JProfile::preloadAsync(JProfile::load(cacheDir + "/jni.profile"), 200).detach();
+class JProfile final
+{
+public:
+    JProfile() = delete;
+
+    /// @brief Start recording lookups (no-op without GUSC_JNI_PROFILE)
+    static inline void start()
+    {
+        Private::ProfileRecorder::get().start();
+    }
+
+    static inline void stop() noexcept
+    {
+        Private::ProfileRecorder::get().stop();
+    }
+
+    static inline bool isRecording() noexcept
+    {
+        return Private::ProfileRecorder::get().isRecording();
+    }
+
+    static inline void clear()
+    {
+        auto env = JVM::getEnv();
+        Private::ProfileRecorder::get().clear(env);
+    }
+
+    /// @brief Recorded entries ordered by the first use
+    static inline std::vector<JProfileEntry> getEntries()
+    {
+        return Private::ProfileRecorder::get().getEntries();
+    }
+
+    /// @brief Write the recorded entries to a file
+    static inline void save(const std::string& path)
+    {
+        save(path, getEntries());
+    }
+
+    /// @brief Write entries to a file (one tab separated line per entry)
+    static void save(const std::string& path, const std::vector<JProfileEntry>& entries)
+    {
+        std::ofstream file { path, std::ios::trunc };
+        if (!file)
+        {
+            throw std::runtime_error("Can't open " + path + " for writing");
+        }
+        file << header << '\n';
+        for (const auto& entry : entries)
+        {
+            file << getKindName(entry.kind) << '\t' << entry.className << '\t' << entry.name << '\t' << entry.signature
+                 << '\t' << entry.count << '\t' << entry.firstUse.count() << '\n';
+        }
+    }
+
+    /// @brief Read entries written by save(), the order of the file is kept
+    static std::vector<JProfileEntry> load(const std::string& path)
+    {
+        std::ifstream file { path };
+        if (!file)
+        {
+            throw std::runtime_error("Can't open " + path + " for reading");
+        }
+        std::string line;
+        if (!std::getline(file, line) || line != header)
+        {
+            throw std::runtime_error(path + " is not a JNI profile");
+        }
+        std::vector<JProfileEntry> entries;
+        while (std::getline(file, line))
+        {
+            if (line.empty())
+            {
+                continue;
+            }
+            std::istringstream stream { line };
+            std::string kind;
+            std::string count;
+            std::string firstUse;
+            JProfileEntry entry;
+            if (!std::getline(stream, kind, '\t') || !std::getline(stream, entry.className, '\t')
+                || !std::getline(stream, entry.name, '\t') || !std::getline(stream, entry.signature, '\t')
+                || !std::getline(stream, count, '\t') || !std::getline(stream, firstUse))
+            {
+                throw std::runtime_error("Malformed JNI profile line: " + line);
+            }
+            entry.kind = getKind(kind);
+            entry.count = std::stoull(count);
+            entry.firstUse = std::chrono::nanoseconds { std::stoll(firstUse) };
+            entries.push_back(std::move(entry));
+        }
+        return entries;
+    }
+
+    /// @brief Resolve the first maxEntries classes and members on the calling thread
+    /// @note missing members (i.e. the Java side changed since the profile was recorded) are reported, not thrown
+    static inline JManifest::Report preload(const std::vector<JProfileEntry>& entries, std::size_t maxEntries = std::numeric_limits<std::size_t>::max())
+    {
+        auto env = JVM::getEnv();
+        return createManifest(entries, maxEntries, nullptr).resolveJni(env);
+    }
+
+    /// @brief Resolve the first maxEntries classes and members on a background thread attached to the JVM
+    /// Classes are loaded with the class loader of the first profiled class that has one (bootstrap classes are
+    /// skipped), so application classes can be found from the background thread.
+    static std::thread preloadAsync(std::vector<JProfileEntry> entries, std::size_t maxEntries = std::numeric_limits<std::size_t>::max())
+    {
+        auto env = JVM::getEnv();
+        auto loader = std::make_shared<ClassLoader>(env, entries);
+        auto manifest = createManifest(entries, maxEntries, loader);
+        return std::thread([manifest = std::move(manifest)]() {
+            try
+            {
+                auto workerEnv = JVM::getEnv();
+                manifest.resolveJni(workerEnv);
+            }
+            catch (...)
+            {
+                // JVM is not available, there is nothing to warm up
+            }
+        });
+    }
+
+    static constexpr const char* getKindName(JMemberKind kind) noexcept
+    {
+        switch (kind)
+        {
+            case JMemberKind::Class:
+                return "class";
+            case JMemberKind::Method:
+                return "method";
+            case JMemberKind::StaticMethod:
+                return "static method";
+            case JMemberKind::Field:
+                return "field";
+            case JMemberKind::StaticField:
+                return "static field";
+        }
+        return "";
+    }
+
+private:
+    static constexpr const char* header = "gusc-jni-profile 1";
+
+    static JMemberKind getKind(const std::string& name)
+    {
+        for (auto kind : { JMemberKind::Class, JMemberKind::Method, JMemberKind::StaticMethod, JMemberKind::Field, JMemberKind::StaticField })
+        {
+            if (name == getKindName(kind))
+            {
+                return kind;
+            }
+        }
+        throw std::runtime_error("Unknown JNI profile entry kind: " + name);
+    }
+
+    /// @brief ClassLoader of the application captured on a thread that can see application classes
+    class ClassLoader final
+    {
+    public:
+        ClassLoader(JEnv& env, const std::vector<JProfileEntry>& entries)
+        {
+            auto classClass = env->FindClass("java/lang/Class");
+            forName = env->GetStaticMethodID(classClass, "forName", "(Ljava/lang/String;ZLjava/lang/ClassLoader;)Ljava/lang/Class;");
+            const auto getClassLoader = env->GetMethodID(classClass, "getClassLoader", "()Ljava/lang/ClassLoader;");
+            cls = static_cast<jclass>(env->NewGlobalRef(classClass));
+            env->DeleteLocalRef(classClass);
+            for (const auto& entry : entries)
+            {
+                auto anchor = env->FindClass(entry.className.c_str());
+                if (!anchor)
+                {
+                    env->ExceptionClear();
+                    continue;
+                }
+                auto localLoader = env->CallObjectMethod(anchor, getClassLoader);
+                env->ExceptionClear();
+                env->DeleteLocalRef(anchor);
+                if (!localLoader)
+                {
+                    // Bootstrap classes (i.e. java/lang/String) have no loader that can see application classes
+                    continue;
+                }
+                loader = env->NewGlobalRef(localLoader);
+                env->DeleteLocalRef(localLoader);
+                break;
+            }
+        }
+        ClassLoader(const ClassLoader&) = delete;
+        ClassLoader& operator=(const ClassLoader&) = delete;
+        ~ClassLoader()
+        {
+            try
+            {
+                auto env = JVM::getEnv();
+                env->DeleteGlobalRef(loader);
+                env->DeleteGlobalRef(cls);
+            }
+            catch (...)
+            {
+            }
+        }
+
+        jclass findClass(JNIEnv* env, const std::string& classPath) const
+        {
+            if (!loader)
+            {
+                return env->FindClass(classPath.c_str());
+            }
+            auto dottedName = classPath;
+            std::replace(dottedName.begin(), dottedName.end(), '/', '.');
+            auto name = env->NewStringUTF(dottedName.c_str());
+            auto res = static_cast<jclass>(env->CallStaticObjectMethod(cls, forName, name, JNI_TRUE, loader));
+            env->DeleteLocalRef(name);
+            return res;
+        }
+
+    private:
+        jclass cls { nullptr };
+        jmethodID forName { nullptr };
+        jobject loader { nullptr };
+    };
+
+    static JManifest createManifest(const std::vector<JProfileEntry>& entries, std::size_t maxEntries, std::shared_ptr<ClassLoader> loader)
+    {
+        JManifest manifest;
+        const auto count = std::min(entries.size(), maxEntries);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto& entry = entries[i];
+            manifest.addEntry(getKindName(entry.kind), entry.className, entry.name, [entry, loader](JEnv& env) {
+                auto cls = loader ? loader->findClass(env, entry.className) : env->FindClass(entry.className.c_str());
+                if (!cls)
+                {
+                    env->ExceptionClear();
+                    throw std::runtime_error("Can't find " + entry.className + " Java class");
+                }
+                bool found { true };
+                switch (entry.kind)
+                {
+                    case JMemberKind::Class:
+                        break;
+                    case JMemberKind::Method:
+                        found = env->GetMethodID(cls, entry.name.c_str(), entry.signature.c_str()) != nullptr;
+                        break;
+                    case JMemberKind::StaticMethod:
+                        found = env->GetStaticMethodID(cls, entry.name.c_str(), entry.signature.c_str()) != nullptr;
+                        break;
+                    case JMemberKind::Field:
+                        found = env->GetFieldID(cls, entry.name.c_str(), entry.signature.c_str()) != nullptr;
+                        break;
+                    case JMemberKind::StaticField:
+                        found = env->GetStaticFieldID(cls, entry.name.c_str(), entry.signature.c_str()) != nullptr;
+                        break;
+                }
+                env->DeleteLocalRef(cls);
+                if (!found)
+                {
+                    env->ExceptionClear();
+                    throw std::runtime_error("Can't find " + entry.name + " with signature " + entry.signature);
+                }
+            });
+        }
+        return manifest;
+    }
+};
+
+}
+
+#endif // __GUSC_JPROFILE_HPP
@@ -0,0 +1,463 @@
+#ifndef __GUSC_JRESULT_HPP
+#define __GUSC_JRESULT_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JObject.hpp"
+#include "JClass.hpp"
+#include "JException.hpp"
+#include "private/signature.hpp"
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace gusc::Jni
+{
+
+enum class JErrorKind
+{
+    None,
+    ClassNotFound,
+    MethodNotFound,
+    FieldNotFound,
+    JavaException,
+    ObjectCreationFailed
+};
+
+namespace Private
+{
+
+/// @brief Error part of JResult, the message is only formatted when it is requested
+class result_error
+{
+public:
+    inline JErrorKind getErrorKind() const noexcept
+    {
+        return kind;
+    }
+
+    inline bool hasError() const noexcept
+    {
+        return kind != JErrorKind::None;
+    }
+
+    std::string getMessage() const
+    {
+        switch (kind)
+        {
+            case JErrorKind::None:
+                return {};
+            case JErrorKind::ClassNotFound:
+                return std::string("Can't find ") + name + " Java class";
+            case JErrorKind::MethodNotFound:
+                return std::string("Can't find method ") + name + " with signature " + signature;
+            case JErrorKind::FieldNotFound:
+                return std::string("Can't find field ") + name + " with signature " + signature;
+            case JErrorKind::JavaException:
+                return exception->what();
+            case JErrorKind::ObjectCreationFailed:
+                return std::string("Failed to create Java object with signature ") + signature;
+        }
+        return {};
+    }
+
+    /// @brief Java exception that was cleared from the env, nullptr unless the kind is JErrorKind::JavaException
+    inline const JException* getException() const noexcept
+    {
+        return exception ? &*exception : nullptr;
+    }
+
+    /// @brief Throw the error the same way the throwing API would
+    void throwIfError() const
+    {
+        if (exception)
+        {
+            throw *exception;
+        }
+        if (hasError())
+        {
+            throw std::runtime_error(getMessage());
+        }
+    }
+
+protected:
+    result_error() = default;
+    result_error(JErrorKind initKind, std::string initName, std::string initSignature)
+        : kind(initKind)
+        , name(std::move(initName))
+        , signature(std::move(initSignature))
+    {}
+    result_error(JException initException)
+        : kind(JErrorKind::JavaException)
+        , exception(std::move(initException))
+    {}
+
+private:
+    JErrorKind kind { JErrorKind::None };
+    std::string name;
+    std::string signature;
+    std::optional<JException> exception;
+};
+
+}
+
+/// @brief Value or error returned by the non-throwing try* API
+/// @code
+///   auto res = obj.tryInvokeMethod<jint>("getValue");
+///   if (!res)
+///   {
+///       LOG(res.getMessage());
+///   }
+template<typename T>
+class JResult final : public Private::result_error
+{
+public:
+    JResult(T initValue)
+        : value(std::move(initValue))
+    {}
+    JResult(JErrorKind initKind, std::string initName, std::string initSignature = {})
+        : result_error(initKind, std::move(initName), std::move(initSignature))
+    {}
+    JResult(JException initException)
+        : result_error(std::move(initException))
+    {}
+
+    /// @brief Take over the pending Java exception and clear it from the env
+    static JResult fromPendingException(JEnv& env)
+    {
+        auto throwable = env->ExceptionOccurred();
+        env->ExceptionClear();
+        return JResult { JException { env, throwable } };
+    }
+
+    inline operator bool() const noexcept
+    {
+        return value.has_value();
+    }
+
+    inline bool hasValue() const noexcept
+    {
+        return value.has_value();
+    }
+
+    /// @note calling this on an error result is undefined behavior
+    inline T& getValue() noexcept
+    {
+        return *value;
+    }
+
+    inline const T& getValue() const noexcept
+    {
+        return *value;
+    }
+
+    inline T getValueOr(T defaultValue) const
+    {
+        return value ? *value : defaultValue;
+    }
+
+private:
+    std::optional<T> value;
+};
+
+template<>
+class JResult<void> final : public Private::result_error
+{
+public:
+    JResult() = default;
+    JResult(JErrorKind initKind, std::string initName, std::string initSignature = {})
+        : result_error(initKind, std::move(initName), std::move(initSignature))
+    {}
+    JResult(JException initException)
+        : result_error(std::move(initException))
+    {}
+
+    static JResult fromPendingException(JEnv& env)
+    {
+        auto throwable = env->ExceptionOccurred();
+        env->ExceptionClear();
+        return JResult { JException { env, throwable } };
+    }
+
+    inline operator bool() const noexcept
+    {
+        return !hasError();
+    }
+
+    inline bool hasValue() const noexcept
+    {
+        return !hasError();
+    }
+};
+
+inline JResult<JClass> JEnv::tryGetClass(const char* classPath)
+{
+    auto cls = env->FindClass(classPath);
+    if (!cls)
+    {
+        env->ExceptionClear();
+        return { JErrorKind::ClassNotFound, classPath };
+    }
+    return JClass(cls).createGlobalRefJni(*this);
+}
+
+inline JResult<jmethodID> JClass::tryGetStaticMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+{
+    auto methodId = env->GetStaticMethodID(jniClass, name.c_str(), signature.c_str());
+    if (!methodId)
+    {
+        env->ExceptionClear();
+        return { JErrorKind::MethodNotFound, name, signature };
+    }
+    return methodId;
+}
+
+inline JResult<jmethodID> JClass::tryGetMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+{
+    auto methodId = env->GetMethodID(jniClass, name.c_str(), signature.c_str());
+    if (!methodId)
+    {
+        env->ExceptionClear();
+        return { JErrorKind::MethodNotFound, name, signature };
+    }
+    return methodId;
+}
+
+inline JResult<jfieldID> JClass::tryGetStaticFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+{
+    auto fieldId = env->GetStaticFieldID(jniClass, name.c_str(), signature.c_str());
+    if (!fieldId)
+    {
+        env->ExceptionClear();
+        return { JErrorKind::FieldNotFound, name, signature };
+    }
+    return fieldId;
+}
+
+inline JResult<jfieldID> JClass::tryGetFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+{
+    auto fieldId = env->GetFieldID(jniClass, name.c_str(), signature.c_str());
+    if (!fieldId)
+    {
+        env->ExceptionClear();
+        return { JErrorKind::FieldNotFound, name, signature };
+    }
+    return fieldId;
+}
+
+template<typename... TArgs>
+inline JResult<JObject> JClass::tryCreateObjectJni(JEnv& env, jmethodID methodId, const TArgs&... args) const
+{
+    auto obj = env->NewObject(jniClass, methodId, Private::to_jni(std::forward<const TArgs&>(args))...);
+    if (env->ExceptionCheck() == JNI_TRUE)
+    {
+        return JResult<JObject>::fromPendingException(env);
+    }
+    if (!obj)
+    {
+        return { JErrorKind::ObjectCreationFailed, "<init>" };
+    }
+    return JObject(obj);
+}
+
+template<typename... TArgs>
+inline JResult<JObject> JClass::tryCreateObjectSign(const std::string& signature, const TArgs&... args) const
+{
+    auto env = JVM::getEnv();
+    auto methodId = tryGetMethodIdJni(env, "<init>", signature);
+    if (!methodId)
+    {
+        return { methodId.getErrorKind(), "<init>", signature };
+    }
+    auto res = tryCreateObjectJni(env, methodId.getValue(), std::forward<const TArgs&>(args)...);
+    if (res.getErrorKind() == JErrorKind::ObjectCreationFailed)
+    {
+        return { JErrorKind::ObjectCreationFailed, "<init>", signature };
+    }
+    return res;
+}
+
+template<typename... TArgs>
+inline JResult<JObject> JClass::tryCreateObject(const TArgs&... args) const
+{
+    constexpr auto sign = Private::getMethodSignature<void, TArgs...>();
+    return tryCreateObjectSign(sign.str, std::forward<const TArgs&>(args)...);
+}
+
+template<typename TReturn, typename... TArgs>
+inline JResult<TReturn> JClass::tryInvokeMethodJni(JEnv& env, jmethodID methodId, const TArgs&... args) const
+{
+    if constexpr (std::is_void_v<TReturn>)
+    {
+        invokeMethodReturnVoid(env, methodId, std::forward<const TArgs&>(args)...);
+        if (env->ExceptionCheck() == JNI_TRUE)
+        {
+            return JResult<TReturn>::fromPendingException(env);
+        }
+        return {};
+    }
+    else
+    {
+        auto res = invokeMethodReturn<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+        if (env->ExceptionCheck() == JNI_TRUE)
+        {
+            return JResult<TReturn>::fromPendingException(env);
+        }
+        return res;
+    }
+}
+
+template<typename TReturn, typename... TArgs>
+inline JResult<TReturn> JClass::tryInvokeMethodSign(const std::string& name, const std::string& signature, const TArgs&... args) const
+{
+    auto env = JVM::getEnv();
+    auto methodId = tryGetStaticMethodIdJni(env, name, signature);
+    if (!methodId)
+    {
+        return { methodId.getErrorKind(), name, signature };
+    }
+    return tryInvokeMethodJni<TReturn>(env, methodId.getValue(), std::forward<const TArgs&>(args)...);
+}
+
+template<typename TReturn, typename... TArgs>
+inline JResult<TReturn> JClass::tryInvokeMethod(const std::string& name, const TArgs&... args) const
+{
+    constexpr auto sign = Private::getMethodSignature<TReturn, TArgs...>();
+    return tryInvokeMethodSign<TReturn>(name, sign.str, std::forward<const TArgs&>(args)...);
+}
+
+template<typename T>
+inline JResult<T> JClass::tryGetFieldSign(const std::string& name, const std::string& signature) const
+{
+    auto env = JVM::getEnv();
+    auto fieldId = tryGetStaticFieldIdJni(env, name, signature);
+    if (!fieldId)
+    {
+        return { fieldId.getErrorKind(), name, signature };
+    }
+    return getFieldValue<T>(env, fieldId.getValue());
+}
+
+template<typename T>
+inline JResult<T> JClass::tryGetField(const std::string& name) const
+{
+    constexpr auto sign = Private::getJTypeSignature<T>();
+    return tryGetFieldSign<T>(name, sign.str);
+}
+
+template<typename T>
+inline JResult<void> JClass::trySetFieldSign(const std::string& name, const std::string& signature, const T& value)
+{
+    auto env = JVM::getEnv();
+    auto fieldId = tryGetStaticFieldIdJni(env, name, signature);
+    if (!fieldId)
+    {
+        return { fieldId.getErrorKind(), name, signature };
+    }
+    setFieldValue<T>(env, fieldId.getValue(), std::forward<const T&>(value));
+    return {};
+}
+
+template<typename T>
+inline JResult<void> JClass::trySetField(const std::string& name, const T& value)
+{
+    constexpr auto sign = Private::getJTypeSignature<T>();
+    return trySetFieldSign<T>(name, sign.str, std::forward<const T&>(value));
+}
+
+inline JResult<jmethodID> JObject::tryGetMethodIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+{
+    return getClass(env).tryGetMethodIdJni(env, name, signature);
+}
+
+inline JResult<jfieldID> JObject::tryGetFieldIdJni(JEnv& env, const std::string& name, const std::string& signature) const
+{
+    return getClass(env).tryGetFieldIdJni(env, name, signature);
+}
+
+template<typename TReturn, typename... TArgs>
+inline JResult<TReturn> JObject::tryInvokeMethodJni(JEnv& env, jmethodID methodId, const TArgs&... args) const
+{
+    if constexpr (std::is_void_v<TReturn>)
+    {
+        invokeMethodReturnVoid(env, methodId, std::forward<const TArgs&>(args)...);
+        if (env->ExceptionCheck() == JNI_TRUE)
+        {
+            return JResult<TReturn>::fromPendingException(env);
+        }
+        return {};
+    }
+    else
+    {
+        auto res = invokeMethodReturn<TReturn>(env, methodId, std::forward<const TArgs&>(args)...);
+        if (env->ExceptionCheck() == JNI_TRUE)
+        {
+            return JResult<TReturn>::fromPendingException(env);
+        }
+        return res;
+    }
+}
+
+template<typename TReturn, typename... TArgs>
+inline JResult<TReturn> JObject::tryInvokeMethodSign(const std::string& name, const std::string& signature, const TArgs&... args) const
+{
+    auto env = JVM::getEnv();
+    auto methodId = tryGetMethodIdJni(env, name, signature);
+    if (!methodId)
+    {
+        return { methodId.getErrorKind(), name, signature };
+    }
+    return tryInvokeMethodJni<TReturn>(env, methodId.getValue(), std::forward<const TArgs&>(args)...);
+}
+
+template<typename TReturn, typename... TArgs>
+inline JResult<TReturn> JObject::tryInvokeMethod(const std::string& name, const TArgs&... args) const
+{
+    constexpr auto sign = Private::getMethodSignature<TReturn, TArgs...>();
+    return tryInvokeMethodSign<TReturn>(name, sign.str, std::forward<const TArgs&>(args)...);
+}
+
+template<typename T>
+inline JResult<T> JObject::tryGetFieldSign(const std::string& name, const std::string& signature) const
+{
+    auto env = JVM::getEnv();
+    auto fieldId = tryGetFieldIdJni(env, name, signature);
+    if (!fieldId)
+    {
+        return { fieldId.getErrorKind(), name, signature };
+    }
+    return getFieldValue<T>(env, fieldId.getValue());
+}
+
+template<typename T>
+inline JResult<T> JObject::tryGetField(const std::string& name) const
+{
+    constexpr auto sign = Private::getJTypeSignature<T>();
+    return tryGetFieldSign<T>(name, sign.str);
+}
+
+template<typename T>
+inline JResult<void> JObject::trySetFieldSign(const std::string& name, const std::string& signature, const T& value)
+{
+    auto env = JVM::getEnv();
+    auto fieldId = tryGetFieldIdJni(env, name, signature);
+    if (!fieldId)
+    {
+        return { fieldId.getErrorKind(), name, signature };
+    }
+    setFieldValue<T>(env, fieldId.getValue(), std::forward<const T&>(value));
+    return {};
+}
+
+template<typename T>
+inline JResult<void> JObject::trySetField(const std::string& name, const T& value)
+{
+    constexpr auto sign = Private::getJTypeSignature<T>();
+    return trySetFieldSign<T>(name, sign.str, std::forward<const T&>(value));
+}
+
+}
+
+#endif // __GUSC_JRESULT_HPP
@@ -13,7 +13,8 @@ class JString final: public JObject
     {
     public:
         JStringData(JEnv env, const jstring& initString)
-            : jniString(initString)
+            : jniEnv(env)
+            , jniString(initString)
         {
             if (jniString)
             {
@@ -38,13 +39,13 @@ class JString final: public JObject
         {
             if (jniString && dataPtr)
             {
-                auto env = JVM::getEnv();
-                env->ReleaseStringUTFChars(jniString, dataPtr);
+                jniEnv->ReleaseStringUTFChars(jniString, dataPtr);
                 dataPtr = nullptr;
                 length = 0;
             }
         }
     private:
+        JEnv jniEnv;
         jstring jniString { nullptr };
         std::size_t length { 0 };
         const char* dataPtr { nullptr };
@@ -53,6 +54,8 @@ public:
     using StlType = std::string;
     using JniType = jstring;
 
+    /// @brief create empty JNI string wrapper
+    JString() = default;
     /// @brief wrap around existing JNI jstring object
     JString(const jstring& initString)
             : JObject(static_cast<jobject>(initString))
@@ -68,6 +71,12 @@ public:
         return static_cast<std::string>(data);
     }
 
+    inline std::string getStringJni(JEnv& env) const
+    {
+        JStringData data(env, static_cast<jstring>(jniObject));
+        return static_cast<std::string>(data);
+    }
+
     inline operator jstring() const
     {
         return static_cast<jstring>(jniObject);
@@ -78,6 +87,11 @@ public:
         return JStringData(JVM::getEnv(), static_cast<jstring>(jniObject));
     }
 
+    inline JStringData getDataJni(JEnv& env) const
+    {
+        return JStringData(env, static_cast<jstring>(jniObject));
+    }
+
     inline static JString createFrom(JEnv env, const std::string& str)
     {
         return JString(env->NewStringUTF(str.c_str()));
@@ -111,6 +125,28 @@ JObject::invokeMethodReturn(JEnv& env, jmethodID methodId, const TArgs&... args)
     return JString(invokeMethodReturn<jstring>(env, methodId, std::forward<const TArgs&>(args)...));
 }
 
+template<typename TReturn>
+inline
+typename std::enable_if_t<
+        std::is_same_v<TReturn, JString>,
+        TReturn
+>
+JObject::invokeMethodReturnA(JEnv& env, jmethodID methodId, const jvalue* args) const noexcept
+{
+    return JString(invokeMethodReturnA<jstring>(env, methodId, args));
+}
+
+template<typename TReturn>
+inline
+typename std::enable_if_t<
+        std::is_same_v<TReturn, JString>,
+        TReturn
+>
+JObject::invokeNonvirtualReturnA(JEnv& env, jclass cls, jmethodID methodId, const jvalue* args) const noexcept
+{
+    return JString(invokeNonvirtualReturnA<jstring>(env, cls, methodId, args));
+}
+
 }
 
 #endif // __GUSC_JSTRING_HPP
@@ -0,0 +1,146 @@
+#ifndef __GUSC_JSTRUCTMAPPING_HPP
+#define __GUSC_JSTRUCTMAPPING_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JClass.hpp"
+#include "private/signature.hpp"
+#include "private/field.hpp"
+#include <array>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace gusc::Jni
+{
+
+/// @brief Pair of a C++ struct member and a Java field name (see JStructMapping)
+template<typename TStruct, typename TMember>
+struct JStructField
+{
+    using Member = TMember;
+
+    TMember TStruct::* member;
+    const char* name;
+
+    static constexpr const char* getSignature()
+    {
+        return signature.str;
+    }
+
+private:
+    static constexpr auto signature = Private::getJTypeSignature<TMember>();
+};
+
+/// @brief Map struct member to a Java field, the field signature is generated at compile time from the member type
+template<typename TStruct, typename TMember>
+constexpr JStructField<TStruct, TMember> mapField(TMember TStruct::* member, const char* name) noexcept
+{
+    return { member, name };
+}
+
+/// @brief Mapping between a C++ struct and the fields of a Java class
+/// All field IDs are resolved once, so load() and store() make exactly one JNI call per field.
+/// @code
+///   struct Settings
+///   {
+///       jint sampleRate;
+///       jfloat gain;
+///       JString name;
+///   };
+///   static const JStructMapping settingsMapping {
+///       cls,
+///       mapField(&Settings::sampleRate, "sampleRate"),
+///       mapField(&Settings::gain, "gain"),
+///       mapField(&Settings::name, "name")
+///   };
+///   auto settings = settingsMapping.load(obj);
+///   settings.gain *= 2.f;
+///   settingsMapping.store(settings, obj);
+template<typename TStruct, typename... TMembers>
+class JStructMapping final
+{
+public:
+    /// @brief resolve all field IDs of the mapping
+    JStructMapping(const JClass& initClass, JStructField<TStruct, TMembers>... initFields)
+        : fields { initFields... }
+    {
+        auto env = JVM::getEnv();
+        resolveJni(env, initClass, std::index_sequence_for<TMembers...>{});
+        cls = initClass.createGlobalRefJni(env);
+    }
+    JStructMapping(const JStructMapping&) = default;
+    JStructMapping& operator=(const JStructMapping&) = default;
+    JStructMapping(JStructMapping&&) = default;
+    JStructMapping& operator=(JStructMapping&&) = default;
+    ~JStructMapping() = default;
+
+    /// @brief Read all mapped fields of the Java object into the struct
+    inline void load(jobject obj, TStruct& out) const
+    {
+        auto env = JVM::getEnv();
+        loadJni(env, obj, out);
+    }
+
+    inline TStruct load(jobject obj) const
+    {
+        TStruct out {};
+        load(obj, out);
+        return out;
+    }
+
+    inline void loadJni(JEnv& env, jobject obj, TStruct& out) const
+    {
+        loadJni(env, obj, out, std::index_sequence_for<TMembers...>{});
+    }
+
+    /// @brief Write all mapped members of the struct into the Java object
+    inline void store(const TStruct& in, jobject obj) const
+    {
+        auto env = JVM::getEnv();
+        storeJni(env, in, obj);
+    }
+
+    inline void storeJni(JEnv& env, const TStruct& in, jobject obj) const noexcept
+    {
+        storeJni(env, in, obj, std::index_sequence_for<TMembers...>{});
+    }
+
+    inline const JClass& getClass() const noexcept
+    {
+        return cls;
+    }
+
+    static constexpr std::size_t size() noexcept
+    {
+        return sizeof...(TMembers);
+    }
+
+private:
+    std::tuple<JStructField<TStruct, TMembers>...> fields;
+    std::array<jfieldID, sizeof...(TMembers)> fieldIds {};
+    JClass cls { nullptr };
+
+    template<std::size_t... I>
+    inline void resolveJni(JEnv& env, const JClass& initClass, std::index_sequence<I...>)
+    {
+        ((fieldIds[I] = initClass.getFieldIdJni(env, std::get<I>(fields).name, std::get<I>(fields).getSignature())), ...);
+    }
+
+    template<std::size_t... I>
+    inline void loadJni(JEnv& env, jobject obj, TStruct& out, std::index_sequence<I...>) const
+    {
+        ((out.*(std::get<I>(fields).member) = Private::getFieldValue<TMembers>(env, obj, fieldIds[I])), ...);
+    }
+
+    template<std::size_t... I>
+    inline void storeJni(JEnv& env, const TStruct& in, jobject obj, std::index_sequence<I...>) const noexcept
+    {
+        (Private::setFieldValue<TMembers>(env, obj, fieldIds[I], in.*(std::get<I>(fields).member)), ...);
+    }
+};
+
+}
+
+#endif // __GUSC_JSTRUCTMAPPING_HPP
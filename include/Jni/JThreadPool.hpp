@@ -0,0 +1,296 @@
+#ifndef __GUSC_JTHREADPOOL_HPP
+#define __GUSC_JTHREADPOOL_HPP 1
+
+#include <jni.h>
+#include "JEnv.hpp"
+#include "JVM.hpp"
+#include "JException.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+/// @brief Pool of worker threads that are attached to the JVM once (as named daemon threads) and stay attached
+/// for the lifetime of the pool. Every worker has its own task queue, idle workers steal tasks from the others.
+/// Tasks receive the worker's JEnv, run inside a JEnvScope (so JVM::getEnv() never attaches or detaches) and inside
+/// a local reference frame that is popped after the task, so return native values or global references.
+/// @code
+///   JThreadPool pool { 4, "AudioJni" };
+///   auto result = pool.submit([&](JEnv& env) {
+///       return method.invokeJni(env, obj, 1);
+///   });
+///   pool.post([](JEnv& env) { ... });
+class JThreadPool final
+{
+public:
+    using Task = std::function<void(JEnv&)>;
+
+    /// @param threadCount - number of worker threads (at least one)
+    /// @param name - Java thread name prefix, workers are named "<name>-<index>"
+    /// @param frameSize - local reference capacity of the frame pushed around every task
+    /// @throws std::runtime_error if no worker could be attached to the JVM
+    explicit JThreadPool(std::size_t threadCount = std::max(1u, std::thread::hardware_concurrency()), std::string name = "JniWorker", jint frameSize = 16)
+        : localFrameSize(frameSize)
+    {
+        if (!JVM::getVm())
+        {
+            throw std::runtime_error("JVM is not initialized");
+        }
+        threadCount = std::max<std::size_t>(1, threadCount);
+        queues.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            queues.push_back(std::make_unique<Queue>());
+        }
+        workers.reserve(threadCount);
+        std::vector<std::future<bool>> attached;
+        attached.reserve(threadCount);
+        for (std::size_t i = 0; i < threadCount; ++i)
+        {
+            std::promise<bool> promise;
+            attached.push_back(promise.get_future());
+            workers.emplace_back(&JThreadPool::run, this, i, name + "-" + std::to_string(i), std::move(promise));
+        }
+        const auto attachedCount = std::count_if(attached.begin(), attached.end(), [](auto& future) {
+            return future.get();
+        });
+        if (attachedCount == 0)
+        {
+            // Every worker has already returned, queued tasks would never run
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+            throw std::runtime_error("Failed to attach JThreadPool workers to the JVM");
+        }
+    }
+    JThreadPool(const JThreadPool&) = delete;
+    JThreadPool& operator=(const JThreadPool&) = delete;
+    JThreadPool(JThreadPool&&) = delete;
+    JThreadPool& operator=(JThreadPool&&) = delete;
+    /// @brief Run all queued tasks, then detach and join the workers
+    ~JThreadPool()
+    {
+        {
+            std::lock_guard lock { stateMutex };
+            stopping = true;
+        }
+        taskAvailable.notify_all();
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    /// @brief Pool used by invokeMethodAsync when no pool is given, started on first use with two workers
+    static JThreadPool& getDefault()
+    {
+        // Leaked intentionally - workers can't be joined from static destructors once the JVM is gone
+        static auto* pool = new JThreadPool(2, "JniAsync");
+        return *pool;
+    }
+
+    /// @brief Queue a task and get its result, Java exceptions left pending by the task are rethrown as JException
+    template<typename TFn>
+    auto submit(TFn&& fn) -> std::future<std::invoke_result_t<std::decay_t<TFn>&, JEnv&>>
+    {
+        using TResult = std::invoke_result_t<std::decay_t<TFn>&, JEnv&>;
+        auto task = std::make_shared<std::packaged_task<TResult(JEnv&)>>([fn = std::forward<TFn>(fn)](JEnv& env) mutable -> TResult {
+            if constexpr (std::is_void_v<TResult>)
+            {
+                fn(env);
+                JEnv::checkException(env);
+            }
+            else
+            {
+                auto res = fn(env);
+                JEnv::checkException(env);
+                return res;
+            }
+        });
+        auto res = task->get_future();
+        push([task](JEnv& env) {
+            (*task)(env);
+        });
+        return res;
+    }
+
+    /// @brief Queue a task without a result, exceptions thrown by the task are dropped
+    template<typename TFn>
+    void post(TFn&& fn)
+    {
+        push(Task { std::forward<TFn>(fn) });
+    }
+
+    /// @brief Block until all queued tasks have finished
+    /// @note must not be called from a task of this pool - the calling task is counted as unfinished, so it would
+    /// wait for itself
+    /// @throws std::logic_error if called from a worker of this pool
+    void wait()
+    {
+        if (currentPool == this)
+        {
+            throw std::logic_error("JThreadPool::wait called from a worker of the same pool");
+        }
+        std::unique_lock lock { stateMutex };
+        idle.wait(lock, [this]() {
+            return unfinished == 0;
+        });
+    }
+
+    inline std::size_t size() const noexcept
+    {
+        return workers.size();
+    }
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    jint localFrameSize { 16 };
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> nextQueue { 0 };
+    std::atomic<std::size_t> queued { 0 };
+    std::mutex stateMutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable idle;
+    std::size_t unfinished { 0 };
+    bool stopping { false };
+
+    inline static thread_local const JThreadPool* currentPool { nullptr };
+    inline static thread_local std::size_t currentIndex { 0 };
+
+    void push(Task task)
+    {
+        // Tasks queued from a worker stay on its own queue, the rest are spread round robin
+        const auto index = currentPool == this ? currentIndex : nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+        {
+            std::lock_guard lock { queues[index]->mutex };
+            queues[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard lock { stateMutex };
+            ++unfinished;
+            queued.fetch_add(1, std::memory_order_relaxed);
+        }
+        taskAvailable.notify_one();
+    }
+
+    bool take(std::size_t index, Task& task)
+    {
+        {
+            // Own queue is used as a stack for cache locality
+            auto& own = *queues[index];
+            std::lock_guard lock { own.mutex };
+            if (!own.tasks.empty())
+            {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        for (std::size_t i = 1; i < queues.size(); ++i)
+        {
+            auto& victim = *queues[(index + i) % queues.size()];
+            std::lock_guard lock { victim.mutex };
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void run(std::size_t index, std::string name, std::promise<bool> attached)
+    {
+        auto vm = JVM::getVm();
+        JNIEnv* jniEnv { nullptr };
+        JavaVMAttachArgs args { JNI_VERSION_1_6, const_cast<char*>(name.c_str()), nullptr };
+        if (vm->AttachCurrentThreadAsDaemon(&jniEnv, &args) != JNI_OK)
+        {
+            // Without a JNIEnv this worker can't run tasks, the other workers steal its queue
+            attached.set_value(false);
+            return;
+        }
+        attached.set_value(true);
+        currentPool = this;
+        currentIndex = index;
+        {
+            JEnvScope scope { jniEnv };
+            JEnv env { jniEnv };
+            Task task;
+            while (true)
+            {
+                if (take(index, task))
+                {
+                    execute(env, task);
+                    task = nullptr;
+                    std::lock_guard lock { stateMutex };
+                    if (--unfinished == 0)
+                    {
+                        idle.notify_all();
+                    }
+                    continue;
+                }
+                std::unique_lock lock { stateMutex };
+                if (stopping && queued.load(std::memory_order_relaxed) == 0)
+                {
+                    break;
+                }
+                taskAvailable.wait(lock, [this]() {
+                    return stopping || queued.load(std::memory_order_relaxed) > 0;
+                });
+            }
+        }
+        currentPool = nullptr;
+        vm->DetachCurrentThread();
+    }
+
+    void execute(JEnv& env, Task& task) noexcept
+    {
+        if (env->PushLocalFrame(localFrameSize) != JNI_OK)
+        {
+            // OutOfMemoryError is pending - the task is dropped, a submitted task's future gets broken_promise
+            env->ExceptionClear();
+            return;
+        }
+        try
+        {
+            task(env);
+        }
+        catch (...)
+        {
+        }
+        if (env->ExceptionCheck())
+        {
+            env->ExceptionClear();
+        }
+        env->PopLocalFrame(nullptr);
+    }
+};
+
+}
+
+#endif // __GUSC_JTHREADPOOL_HPP
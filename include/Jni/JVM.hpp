@@ -15,6 +15,10 @@ public:
     }
     static inline JEnv getEnv()
     {
+        if (scopedEnv)
+        {
+            return JEnv(scopedEnv);
+        }
         if (vm)
         {
             JNIEnv *env { nullptr };
@@ -41,8 +45,64 @@ public:
         }
         throw std::runtime_error("Java can not detach from thread!");
     }
+    /// @brief Get JavaVM passed to init (nullptr if JVM is not initialized)
+    static inline JavaVM* getVm() noexcept
+    {
+        return vm;
+    }
+    /// @brief Get JNIEnv installed by JEnvScope on the current thread (nullptr if there is none)
+    static inline JNIEnv* getScopedEnv() noexcept
+    {
+        return scopedEnv;
+    }
+    /// @brief Get JNIEnv of the current thread without attaching it (nullptr if the thread is not attached)
+    static inline JNIEnv* getAttachedEnv() noexcept
+    {
+        if (scopedEnv)
+        {
+            return scopedEnv;
+        }
+        JNIEnv* env { nullptr };
+        if (vm && vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) == JNI_OK)
+        {
+            return env;
+        }
+        return nullptr;
+    }
 private:
+    friend class JEnvScope;
+
     inline static JavaVM* vm { nullptr };
+    inline static thread_local JNIEnv* scopedEnv { nullptr };
+};
+
+/// @brief Install a JNIEnv for the current thread, so that every JVM::getEnv() call inside the scope
+/// returns it without calling JavaVM::GetEnv
+/// @note Native method trampolines (JNativeMethod) install the incoming env automatically
+/// @code
+///   static void myNativeMethod(JNIEnv* env, jobject thiz)
+///   {
+///       JEnvScope scope { env };
+///       ...
+///   }
+class JEnvScope final
+{
+public:
+    explicit JEnvScope(JNIEnv* env) noexcept
+        : previousEnv(JVM::scopedEnv)
+    {
+        JVM::scopedEnv = env;
+    }
+    JEnvScope(const JEnvScope&) = delete;
+    JEnvScope& operator=(const JEnvScope&) = delete;
+    JEnvScope(JEnvScope&&) = delete;
+    JEnvScope& operator=(JEnvScope&&) = delete;
+    ~JEnvScope()
+    {
+        JVM::scopedEnv = previousEnv;
+    }
+private:
+    JNIEnv* previousEnv { nullptr };
 };
     
 }
@@ -7,7 +7,28 @@
 #include "JObject.hpp"
 #include "JClass.hpp"
 #include "JString.hpp"
+#include "JException.hpp"
+#include "JResult.hpp"
 #include "JArray.hpp"
+#include "JBoxed.hpp"
+#include "JCollection.hpp"
+#include "JEnum.hpp"
 #include "JGlobalRef.hpp"
+#include "JMethodCache.hpp"
+#include "JMethod.hpp"
+#include "JField.hpp"
+#include "JConstant.hpp"
+#include "JManifest.hpp"
+#include "JProfile.hpp"
+#include "JThreadPool.hpp"
+#include "JAsync.hpp"
+#include "JEventQueue.hpp"
+#if defined(GUSC_JNI_COROUTINES)
+#include "JCoroutine.hpp"
+#endif
+#include "JStructMapping.hpp"
+#include "JColumnExtractor.hpp"
+#include "JNativePeer.hpp"
+#include "JNativeMethod.hpp"
 
 #endif // __GUSC_JNI_HPP
@@ -70,6 +70,17 @@ typename std::enable_if_t<
     return static_cast<typename std::decay_t<T>::JniType>(in);
 }
 
+/// @brief C++ enums mapped to Java enums are passed as the Java enum constant (see JEnumMapping)
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_enum_v<std::decay_t<T>>,
+    jobject
+> to_jni(T&& in)
+{
+    return JEnumMapping<std::decay_t<T>>::toJni(in);
+}
+
 }
 
 #endif //__GUSC_PRIVATE_CAST_HPP
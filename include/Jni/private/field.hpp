@@ -0,0 +1,450 @@
+#ifndef __GUSC_PRIVATE_FIELD_HPP
+#define __GUSC_PRIVATE_FIELD_HPP 1
+
+#include "forward.hpp"
+#include "cast.hpp"
+#include <type_traits>
+
+namespace gusc::Jni::Private
+{
+
+template<typename T, typename = void>
+struct jni_type
+{
+    using type = T;
+};
+
+template<typename T>
+struct jni_type<T, std::void_t<typename T::JniType>>
+{
+    using type = typename T::JniType;
+};
+
+/// @brief JNI type that is used to transfer T (i.e. jstring for JString, jobject for JObjectS<ClassName>)
+template<typename T>
+using jni_type_t = typename jni_type<T>::type;
+
+template<typename T>
+inline constexpr bool is_jni_wrapper_v = !std::is_same_v<jni_type_t<T>, T>;
+
+/// @brief Convert a local reference returned by JNI into T, wrapper types take over the reference
+template<typename T>
+inline
+typename std::enable_if_t<
+    is_jni_wrapper_v<T>,
+    T
+> from_jni_local(JNIEnv* env, jobject local)
+{
+    T res { static_cast<jni_type_t<T>>(local) };
+    if (local)
+    {
+        env->DeleteLocalRef(local);
+    }
+    return res;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    !is_jni_wrapper_v<T>,
+    T
+> from_jni_local(JNIEnv* /*env*/, jobject local) noexcept
+{
+    return static_cast<T>(local);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jboolean>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId) noexcept
+{
+    return env->GetBooleanField(obj, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jchar>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId) noexcept
+{
+    return env->GetCharField(obj, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jbyte>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId) noexcept
+{
+    return env->GetByteField(obj, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jshort>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId) noexcept
+{
+    return env->GetShortField(obj, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jint>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId) noexcept
+{
+    return env->GetIntField(obj, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jlong>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId) noexcept
+{
+    return env->GetLongField(obj, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jfloat>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId) noexcept
+{
+    return env->GetFloatField(obj, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jdouble>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId) noexcept
+{
+    return env->GetDoubleField(obj, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    !std::is_same_v<T, jboolean> &&
+    !std::is_same_v<T, jchar> &&
+    !std::is_same_v<T, jbyte> &&
+    !std::is_same_v<T, jshort> &&
+    !std::is_same_v<T, jint> &&
+    !std::is_same_v<T, jlong> &&
+    !std::is_same_v<T, jfloat> &&
+    !std::is_same_v<T, jdouble> &&
+    !std::is_same_v<T, void>,
+    T
+> getFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId)
+{
+    return from_jni_local<T>(env, env->GetObjectField(obj, fieldId));
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jboolean>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetBooleanField(obj, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jchar>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetCharField(obj, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jbyte>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetByteField(obj, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jshort>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetShortField(obj, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jint>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetIntField(obj, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jlong>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetLongField(obj, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jfloat>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetFloatField(obj, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jdouble>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetDoubleField(obj, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    !std::is_same_v<T, jboolean> &&
+    !std::is_same_v<T, jchar> &&
+    !std::is_same_v<T, jbyte> &&
+    !std::is_same_v<T, jshort> &&
+    !std::is_same_v<T, jint> &&
+    !std::is_same_v<T, jlong> &&
+    !std::is_same_v<T, jfloat> &&
+    !std::is_same_v<T, jdouble> &&
+    !std::is_same_v<T, void>,
+    void
+> setFieldValue(JNIEnv* env, jobject obj, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetObjectField(obj, fieldId, static_cast<jobject>(to_jni(value)));
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jboolean>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId) noexcept
+{
+    return env->GetStaticBooleanField(cls, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jchar>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId) noexcept
+{
+    return env->GetStaticCharField(cls, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jbyte>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId) noexcept
+{
+    return env->GetStaticByteField(cls, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jshort>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId) noexcept
+{
+    return env->GetStaticShortField(cls, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jint>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId) noexcept
+{
+    return env->GetStaticIntField(cls, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jlong>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId) noexcept
+{
+    return env->GetStaticLongField(cls, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jfloat>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId) noexcept
+{
+    return env->GetStaticFloatField(cls, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jdouble>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId) noexcept
+{
+    return env->GetStaticDoubleField(cls, fieldId);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    !std::is_same_v<T, jboolean> &&
+    !std::is_same_v<T, jchar> &&
+    !std::is_same_v<T, jbyte> &&
+    !std::is_same_v<T, jshort> &&
+    !std::is_same_v<T, jint> &&
+    !std::is_same_v<T, jlong> &&
+    !std::is_same_v<T, jfloat> &&
+    !std::is_same_v<T, jdouble> &&
+    !std::is_same_v<T, void>,
+    T
+> getStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId)
+{
+    return from_jni_local<T>(env, env->GetStaticObjectField(cls, fieldId));
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jboolean>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticBooleanField(cls, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jchar>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticCharField(cls, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jbyte>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticByteField(cls, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jshort>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticShortField(cls, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jint>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticIntField(cls, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jlong>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticLongField(cls, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jfloat>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticFloatField(cls, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<T, jdouble>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticDoubleField(cls, fieldId, value);
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    !std::is_same_v<T, jboolean> &&
+    !std::is_same_v<T, jchar> &&
+    !std::is_same_v<T, jbyte> &&
+    !std::is_same_v<T, jshort> &&
+    !std::is_same_v<T, jint> &&
+    !std::is_same_v<T, jlong> &&
+    !std::is_same_v<T, jfloat> &&
+    !std::is_same_v<T, jdouble> &&
+    !std::is_same_v<T, void>,
+    void
+> setStaticFieldValue(JNIEnv* env, jclass cls, jfieldID fieldId, const T& value) noexcept
+{
+    env->SetStaticObjectField(cls, fieldId, static_cast<jobject>(to_jni(value)));
+}
+
+}
+
+#endif // __GUSC_PRIVATE_FIELD_HPP
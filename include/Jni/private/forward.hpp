@@ -4,9 +4,13 @@
 namespace gusc::Jni
 {
     class JClass;
+    template<const char ClassName[]>
+    struct JClassS;
     class JObject;
     template<const char ClassName[]>
     struct JObjectS;
+    template<typename TSignature, std::size_t N=4>
+    class JMethodCache;
     class JString;
     template<typename TCpp=std::vector<std::int8_t>, typename TJArray=jbyteArray, typename TJArrayElement=jbyte>
     class JArray;
@@ -21,6 +25,13 @@ namespace gusc::Jni
     class JObjectArray;
     template<const char ClassName[]>
     class JObjectArrayS;
+    template<typename T>
+    class JResult;
+    class JThreadPool;
+    template<typename TEnum>
+    struct JEnumTraits;
+    template<typename TEnum>
+    class JEnumMapping;
 }
 
 #endif //__GUSC_PRIVATE_FORWARD_HPP
@@ -0,0 +1,137 @@
+#ifndef __GUSC_PRIVATE_JVALUE_HPP
+#define __GUSC_PRIVATE_JVALUE_HPP 1
+
+#include "forward.hpp"
+#include "cast.hpp"
+#include <array>
+#include <type_traits>
+
+namespace gusc::Jni::Private
+{
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<std::decay_t<T>, jboolean>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.z = in;
+    return value;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<std::decay_t<T>, jbyte>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.b = in;
+    return value;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<std::decay_t<T>, jchar>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.c = in;
+    return value;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<std::decay_t<T>, jshort>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.s = in;
+    return value;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<std::decay_t<T>, jint>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.i = in;
+    return value;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<std::decay_t<T>, jlong>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.j = in;
+    return value;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<std::decay_t<T>, jfloat>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.f = in;
+    return value;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    std::is_same_v<std::decay_t<T>, jdouble>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.d = in;
+    return value;
+}
+
+template<typename T>
+inline
+typename std::enable_if_t<
+    !std::is_same_v<std::decay_t<T>, jboolean> &&
+    !std::is_same_v<std::decay_t<T>, jbyte> &&
+    !std::is_same_v<std::decay_t<T>, jchar> &&
+    !std::is_same_v<std::decay_t<T>, jshort> &&
+    !std::is_same_v<std::decay_t<T>, jint> &&
+    !std::is_same_v<std::decay_t<T>, jlong> &&
+    !std::is_same_v<std::decay_t<T>, jfloat> &&
+    !std::is_same_v<std::decay_t<T>, jdouble>,
+    jvalue
+> to_jvalue(const T& in) noexcept
+{
+    jvalue value;
+    value.l = static_cast<jobject>(to_jni(in));
+    return value;
+}
+
+/// @brief Pack call arguments into a jvalue array that lives on the caller's stack
+/// @note the array size is known at compile time, so no heap allocation or signature walking is needed
+template<typename... TArgs>
+inline std::array<jvalue, sizeof...(TArgs)> to_jvalues(const TArgs&... args) noexcept
+{
+    return {{ to_jvalue(args)... }};
+}
+
+}
+
+#endif // __GUSC_PRIVATE_JVALUE_HPP
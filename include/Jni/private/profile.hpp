@@ -0,0 +1,213 @@
+#ifndef __GUSC_PRIVATE_PROFILE_HPP
+#define __GUSC_PRIVATE_PROFILE_HPP 1
+
+#include <jni.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gusc::Jni
+{
+
+enum class JMemberKind
+{
+    Class,
+    Method,
+    StaticMethod,
+    Field,
+    StaticField
+};
+
+/// @brief Class or member resolved during a profiling run (see JProfile)
+struct JProfileEntry
+{
+    JMemberKind kind { JMemberKind::Class };
+    /// @brief JNI class path (i.e. java/lang/String)
+    std::string className;
+    std::string name;
+    std::string signature;
+    /// @brief Number of lookups
+    std::uint64_t count { 0 };
+    /// @brief Time of the first lookup since the recording was started
+    std::chrono::nanoseconds firstUse { 0 };
+};
+
+namespace Private
+{
+
+/// @brief Process-wide recorder of class and member lookups, only used when built with GUSC_JNI_PROFILE
+class ProfileRecorder final
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static ProfileRecorder& get()
+    {
+        // Leaked intentionally - holds global references that must outlive static destructors
+        static auto* recorder = new ProfileRecorder();
+        return *recorder;
+    }
+
+    inline bool isRecording() const noexcept
+    {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    void start()
+    {
+        std::lock_guard lock { mutex };
+        startTime = Clock::now();
+        recording.store(true, std::memory_order_relaxed);
+    }
+
+    void stop() noexcept
+    {
+        recording.store(false, std::memory_order_relaxed);
+    }
+
+    void clear(JNIEnv* env)
+    {
+        std::lock_guard lock { mutex };
+        for (const auto& member : members)
+        {
+            for (const auto& recorded : member.second)
+            {
+                env->DeleteGlobalRef(recorded.first);
+            }
+        }
+        members.clear();
+        classes.clear();
+    }
+
+    void recordClass(const char* classPath)
+    {
+        const auto now = Clock::now();
+        std::lock_guard lock { mutex };
+        auto& entry = classes[classPath];
+        if (!entry.count)
+        {
+            entry.className = classPath;
+            entry.firstUse = std::chrono::duration_cast<std::chrono::nanoseconds>(now - startTime);
+        }
+        ++entry.count;
+    }
+
+    void recordMember(JNIEnv* env, JMemberKind kind, jclass cls, const std::string& name, const std::string& signature)
+    {
+        const auto now = Clock::now();
+        auto key = std::to_string(static_cast<int>(kind)) + name + signature;
+        std::lock_guard lock { mutex };
+        auto& candidates = members[std::move(key)];
+        // The same member name in different classes is rare, so the identity scan is short
+        for (auto& recorded : candidates)
+        {
+            if (env->IsSameObject(recorded.first, cls) == JNI_TRUE)
+            {
+                ++recorded.second.count;
+                return;
+            }
+        }
+        JProfileEntry entry;
+        entry.kind = kind;
+        entry.className = getClassPath(env, cls);
+        entry.name = name;
+        entry.signature = signature;
+        entry.count = 1;
+        entry.firstUse = std::chrono::duration_cast<std::chrono::nanoseconds>(now - startTime);
+        candidates.emplace_back(static_cast<jclass>(env->NewGlobalRef(cls)), std::move(entry));
+    }
+
+    /// @brief All recorded entries ordered by the first use
+    std::vector<JProfileEntry> getEntries() const
+    {
+        std::vector<JProfileEntry> res;
+        {
+            std::lock_guard lock { mutex };
+            for (const auto& entry : classes)
+            {
+                res.push_back(entry.second);
+            }
+            for (const auto& member : members)
+            {
+                for (const auto& recorded : member.second)
+                {
+                    res.push_back(recorded.second);
+                }
+            }
+        }
+        std::stable_sort(res.begin(), res.end(), [](const auto& a, const auto& b) {
+            return a.firstUse < b.firstUse;
+        });
+        return res;
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::atomic<bool> recording { false };
+    Clock::time_point startTime { Clock::now() };
+    std::unordered_map<std::string, JProfileEntry> classes;
+    std::unordered_map<std::string, std::vector<std::pair<jclass, JProfileEntry>>> members;
+
+    ProfileRecorder() = default;
+
+    static std::string getClassPath(JNIEnv* env, jclass cls)
+    {
+        auto classClass = env->GetObjectClass(cls);
+        const auto getNameId = env->GetMethodID(classClass, "getName", "()Ljava/lang/String;");
+        env->DeleteLocalRef(classClass);
+        auto name = static_cast<jstring>(env->CallObjectMethod(cls, getNameId));
+        if (!name)
+        {
+            env->ExceptionClear();
+            return {};
+        }
+        const auto chars = env->GetStringUTFChars(name, nullptr);
+        std::string res { chars };
+        env->ReleaseStringUTFChars(name, chars);
+        env->DeleteLocalRef(name);
+        std::replace(res.begin(), res.end(), '.', '/');
+        return res;
+    }
+};
+
+inline void profile_class(const char* classPath)
+{
+#if defined(GUSC_JNI_PROFILE)
+    auto& recorder = ProfileRecorder::get();
+    if (recorder.isRecording())
+    {
+        recorder.recordClass(classPath);
+    }
+#else
+    (void)classPath;
+#endif
+}
+
+inline void profile_member(JNIEnv* env, JMemberKind kind, jclass cls, const std::string& name, const std::string& signature)
+{
+#if defined(GUSC_JNI_PROFILE)
+    auto& recorder = ProfileRecorder::get();
+    if (recorder.isRecording())
+    {
+        recorder.recordMember(env, kind, cls, name, signature);
+    }
+#else
+    (void)env;
+    (void)kind;
+    (void)cls;
+    (void)name;
+    (void)signature;
+#endif
+}
+
+}
+
+}
+
+#endif //__GUSC_PRIVATE_PROFILE_HPP
@@ -254,6 +254,21 @@ getJTypeSignature()
     return concat(a.str, b.str, c.str);
 }
 
+/// @brief C++ enums mapped to Java enums with JEnumTraits
+template<typename T>
+inline constexpr
+typename std::enable_if_t<
+        std::is_enum_v<T>,
+        char_string<str_len(JEnumTraits<T>::getClassName()) + 3>
+>
+getJTypeSignature()
+{
+    constexpr auto a = concat("L");
+    constexpr auto b = get_class_path<JEnumTraits<T>>();
+    constexpr auto c = concat(";");
+    return concat(a.str, b.str, c.str);
+}
+
 template<typename... TArgs>
 inline constexpr auto getArgumentSignature()
 {
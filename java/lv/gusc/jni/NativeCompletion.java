@@ -0,0 +1,23 @@
+package lv.gusc.jni;
+
+import java.util.function.BiConsumer;
+
+/**
+ * Completion callback of a CompletableFuture awaited from a C++ coroutine (see JCoroutine.hpp).
+ * The handle is owned by the native awaiter and accept() is called at most once.
+ */
+public final class NativeCompletion implements BiConsumer<Object, Throwable> {
+
+    private final long handle;
+
+    NativeCompletion(long handle) {
+        this.handle = handle;
+    }
+
+    @Override
+    public void accept(Object result, Throwable error) {
+        complete(handle, result, error);
+    }
+
+    private static native void complete(long handle, Object result, Throwable error);
+}